@@ -15,6 +15,7 @@
 
 #include "utility.hpp"
 #include <algorithm>
+#include <new>
 
 namespace ft
 {
@@ -58,17 +59,18 @@ public:
 	
 	typedef typename allocator_type::template rebind<Node>::other	node_allocator_type;
 private:
-	Node *			__root;
-	size_type		__size;
-	allocator_type	__alloc;
-	comparator_type	__comp;
+	Node *				__root;
+	size_type			__size;
+	allocator_type		__alloc;
+	node_allocator_type	__node_alloc;
+	comparator_type		__comp;
 public:
-	RBTree() : __root(NULL), __size(0), __alloc()
+	RBTree() : __root(NULL), __size(0), __alloc(), __node_alloc(__alloc)
 	{}
 
 	explicit RBTree( const Compare& comp,
 						const Allocator& alloc = Allocator() )
-			: __comp(comp), __alloc(alloc), __root(NULL), __size(0)
+			: __root(NULL), __size(0), __alloc(alloc), __node_alloc(__alloc), __comp(comp)
 	{}
 
 	RBTree( const RBTree& other );
@@ -78,6 +80,18 @@ public:
 
 	RBTree& operator=( const RBTree& other );
 
+# if FT_CXX11
+	RBTree( RBTree&& other ) noexcept :
+			__root(other.__root), __size(other.__size), __alloc(other.__alloc),
+			__node_alloc(__alloc), __comp(other.__comp)
+	{
+		other.__root = NULL;
+		other.__size = 0;
+	}
+
+	RBTree& operator=( RBTree&& other );
+# endif
+
 	allocator_type get_allocator() const
 	{ return __alloc; }
 
@@ -88,7 +102,7 @@ public:
 	{ return __size; }
 
 	size_type	max_size() const
-	{ return (node_allocator_type().max_size()); }
+	{ return (__node_alloc.max_size()); }
 
 	iterator		begin()
 	{
@@ -137,6 +151,21 @@ public:
 	template< class InputIt >
 	void insert( InputIt first, InputIt last );
 
+# if FT_CXX11
+	ft::pair<iterator,bool> insert( value_type&& value )
+	{ return emplace(std::move(value)); }
+
+	iterator insert( iterator hint, value_type&& value )
+	{ return emplace_hint(hint, std::move(value)); }
+
+	template< class... Args >
+	ft::pair<iterator,bool> emplace( Args&&... args );
+
+	template< class... Args >
+	iterator emplace_hint( iterator /*hint*/, Args&&... args )
+	{ return emplace(std::forward<Args>(args)...).first; }
+# endif
+
 	void erase( iterator pos );
 	void erase( iterator first, iterator last );
 	size_type erase( const value_type& key );
@@ -163,20 +192,57 @@ public:
 	{ _clear_tree(__root); __root = NULL; }
 private:
 
-	Node *	_get_new_node(const T& value, Node *parent = NULL, Node *left = NULL,
-							Node *right = NULL, bool is_red = true)
+	// only the value is constructed in place, the links are plain
+	// pointers, so no temporary Node has to be built and copied
+	Node *	_allocate_node(Node *parent)
 	{
-		Node	* tmp = node_allocator_type().allocate(1);
-		node_allocator_type().construct(
-				tmp, Node(value, left, right, parent, is_red));
+		Node	* tmp = __node_alloc.allocate(1);
+		tmp->left = NULL;
+		tmp->right = NULL;
+		tmp->parent = parent;
+		tmp->is_red = true;
+		return tmp;
+	}
+
+	Node *	_get_new_node(const T& value, Node *parent = NULL)
+	{
+		Node	* tmp = _allocate_node(parent);
+		try
+		{
+			::new (static_cast<void *>(&tmp->value)) T(value);
+		}
+		catch (...)
+		{
+			__node_alloc.deallocate(tmp, 1);
+			throw ;
+		}
 		__size++;
 		return tmp;
 	}
 
+# if FT_CXX11
+	template< class... Args >
+	Node *	_emplace_new_node(Args&&... args)
+	{
+		Node	* tmp = _allocate_node(NULL);
+		try
+		{
+			::new (static_cast<void *>(&tmp->value)) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			__node_alloc.deallocate(tmp, 1);
+			throw ;
+		}
+		__size++;
+		return tmp;
+	}
+# endif
+
 	void	_remove_node(Node	*node)
 	{
-		node_allocator_type().destroy(node);
-		node_allocator_type().deallocate(node, 1);
+		node->value.~T();
+		__node_alloc.deallocate(node, 1);
 		__size--;
 	}
 
@@ -185,10 +251,13 @@ private:
 
 	Node *	_find_node(const T & key) const;
 	ft::pair<Node*, bool>	_insert_to_tree(Node **tree, const T & key);
+	ft::pair<Node*, bool>	_link_node(Node *node);
 	void	_fix_node_after_inserting(Node *node);
 
 	void	_copy_tree(Node *&current, Node *curr_parent, Node *other_node);
 	void	_clear_tree(Node *current);
+	void	_free_tree(Node *current);
+	void	_destroy_tree(Node *current);
 
 	void	_rotate_left(Node * node);
 	void	_rotate_right(Node * node);
@@ -214,11 +283,38 @@ void	RBTree<T, Compare, Allocator>::_clear_tree(Node *current)
 {
 	if (current == NULL)
 		return ;
-	_clear_tree(current->left);
-	_clear_tree(current->right);
+	if (deallocation_is_noop(__node_alloc))
+	{
+		// the nodes go away together with the resource, only
+		// the destructors of the values still have to run
+		if (not is_trivially_destructible<T>::value)
+			_destroy_tree(current);
+		__size = 0;
+		return ;
+	}
+	_free_tree(current);
+}
+
+template <class T, class Compare, class Allocator>
+void	RBTree<T, Compare, Allocator>::_free_tree(Node *current)
+{
+	if (current == NULL)
+		return ;
+	_free_tree(current->left);
+	_free_tree(current->right);
 	_remove_node(current);
 }
 
+template <class T, class Compare, class Allocator>
+void	RBTree<T, Compare, Allocator>::_destroy_tree(Node *current)
+{
+	if (current == NULL)
+		return ;
+	_destroy_tree(current->left);
+	_destroy_tree(current->right);
+	current->value.~T();
+}
+
 template <class T, class Compare, class Allocator>
 typename RBTree<T, Compare, Allocator>::Node *	RBTree<T, Compare, Allocator>::_find_node(const T & key) const
 {
@@ -261,6 +357,29 @@ ft::pair<typename RBTree<T, Compare, Allocator>::Node *, bool>	RBTree<T, Compare
 	return ft::make_pair(*tree, true);
 }
 
+template <class T, class Compare, class Allocator>
+ft::pair<typename RBTree<T, Compare, Allocator>::Node *, bool>	RBTree<T, Compare, Allocator>::_link_node(Node *node)
+{
+	// node is already built, put it in place or report the equal one
+	Node	**tree = &__root;
+	Node	*parent = NULL;
+
+	while (*tree != NULL)
+	{
+		parent = *tree;
+		if (__comp(node->value, (*tree)->value))
+			tree = &((*tree)->left);
+		else if (__comp((*tree)->value, node->value))
+			tree = &((*tree)->right);
+		else
+			return ft::make_pair(*tree, false);
+	}
+	node->parent = parent;
+	*tree = node;
+	_fix_node_after_inserting(node);
+	return ft::make_pair(node, true);
+}
+
 template <class T, class Compare, class Allocator>
 void	RBTree<T, Compare, Allocator>::_fix_node_after_inserting(Node *node)
 {
@@ -607,7 +726,8 @@ void	RBTree<T, Compare, Allocator>::_rotate_right(Node * node)
 // public methods
 template <class T, class Compare, class Allocator>
 RBTree<T, Compare, Allocator>::RBTree( const RBTree& other ) :
-		__alloc(other.__alloc), __comp(other.__comp), __root(NULL)
+		__root(NULL), __size(0), __alloc(other.__alloc), __node_alloc(__alloc),
+		__comp(other.__comp)
 {
 	_copy_tree(__root, NULL, other.__root);
 	__size = other.__size;
@@ -625,6 +745,24 @@ RBTree<T, Compare, Allocator>&	RBTree<T, Compare, Allocator>::operator=( const R
 	return *this;
 }
 
+# if FT_CXX11
+template <class T, class Compare, class Allocator>
+RBTree<T, Compare, Allocator>&	RBTree<T, Compare, Allocator>::operator=( RBTree&& other )
+{
+	if (this == &other)
+		return *this;
+	if (not (__node_alloc == other.__node_alloc))
+		return *this = other;
+	_clear_tree(__root);
+	__root = other.__root;
+	__size = other.__size;
+	__comp = other.__comp;
+	other.__root = NULL;
+	other.__size = 0;
+	return *this;
+}
+# endif
+
 template <class T>
 class	RBTreeIterator :
 		public ft::iterator<std::bidirectional_iterator_tag, T>
@@ -846,6 +984,21 @@ RBTree<T, Compare, Allocator>::insert( const T& value )
 	return ft::make_pair(iterator(tmp.first, __root), tmp.second);
 }
 
+# if FT_CXX11
+template <class T, class Compare, class Allocator>
+template< class... Args >
+ft::pair<typename RBTree<T, Compare, Allocator>::iterator, bool>
+RBTree<T, Compare, Allocator>::emplace( Args&&... args )
+{
+	// the key is only known once the value is built
+	Node	*node = _emplace_new_node(std::forward<Args>(args)...);
+	ft::pair<Node *, bool>	tmp = _link_node(node);
+	if (not tmp.second)
+		_remove_node(node);
+	return ft::make_pair(iterator(tmp.first, __root), tmp.second);
+}
+# endif
+
 template <class T, class Compare, class Allocator>
 template< class InputIt >
 void	RBTree<T, Compare, Allocator>::insert( InputIt first, InputIt last )
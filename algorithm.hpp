@@ -0,0 +1,1160 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   algorithm.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 13:47:52 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 13:47:52 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_ALGORITHM_HPP
+# define FT_ALGORITHM_HPP
+
+# include <new>
+# include <cstddef>
+# include <cstring>
+# include <climits>
+# include "utility.hpp"
+# include "simd.hpp"
+
+namespace ft
+{
+
+namespace detail
+{
+	// which kernel of simd.hpp serves a range of T:
+	// 0 none, 1 int, 2 unsigned int, 3 float
+	template <class T>	struct __algo_kind :			integral_constant<int, 0> {};
+	template <>	struct __algo_kind<int> :
+						integral_constant<int, sizeof(int) == 4 ? 1 : 0> {};
+	template <>	struct __algo_kind<unsigned int> :
+						integral_constant<int, sizeof(int) == 4 ? 2 : 0> {};
+	template <>	struct __algo_kind<float> :				integral_constant<int, 3> {};
+
+	// kind of a contiguous range whose elements are compared to a U,
+	// 0 when the range isn't contiguous or U isn't exactly its value type
+	template <class It, class U = typename remove_const<
+						typename iterator_traits<It>::value_type>::type>
+	struct __algo_dispatch : integral_constant<int,
+			is_contiguous_iterator<It>::value
+			and is_same<typename remove_const<typename iterator_traits<It>::value_type>::type,
+						U>::value
+			? __algo_kind<U>::value : 0>
+	{};
+
+	// the kernels work on int for both int and unsigned int
+	inline const int *	__as_int( const int * p )
+	{ return p; }
+
+	inline const int *	__as_int( const unsigned int * p )
+	{ return reinterpret_cast<const int *>(p); }
+
+	inline int *	__as_int( int * p )
+	{ return p; }
+
+	inline int *	__as_int( unsigned int * p )
+	{ return reinterpret_cast<int *>(p); }
+
+	inline const float *	__as_int( const float * p )
+	{ return p; }
+
+	inline float *	__as_int( float * p )
+	{ return p; }
+
+	inline int		__as_int( unsigned int x )
+	{ return static_cast<int>(x); }
+
+	inline int		__as_int( int x )
+	{ return x; }
+
+	inline float	__as_int( float x )
+	{ return x; }
+
+
+	template <class InputIt, class T>
+	InputIt	__find( InputIt first, InputIt last, const T& value, integral_constant<int, 0> )
+	{
+		for (; first != last; ++first)
+			if (*first == value)
+				return first;
+		return first;
+	}
+
+	template <class It, class T, int Kind>
+	It		__find( It first, It last, const T& value, integral_constant<int, Kind> )
+	{
+		std::size_t	n = last - first;
+		if (n == 0)
+			return last;
+		return first + detail::__find(detail::__as_int(detail::__to_address(first)), n,
+										detail::__as_int(value));
+	}
+
+	template <class InputIt, class T>
+	typename iterator_traits<InputIt>::difference_type
+		__count( InputIt first, InputIt last, const T& value, integral_constant<int, 0> )
+	{
+		typename iterator_traits<InputIt>::difference_type	res = 0;
+		for (; first != last; ++first)
+			if (*first == value)
+				++res;
+		return res;
+	}
+
+	template <class It, class T, int Kind>
+	typename iterator_traits<It>::difference_type
+		__count( It first, It last, const T& value, integral_constant<int, Kind> )
+	{
+		std::size_t	n = last - first;
+		if (n == 0)
+			return 0;
+		return detail::__count(detail::__as_int(detail::__to_address(first)), n,
+								detail::__as_int(value));
+	}
+
+	template <class ForwardIt, class T>
+	void	__replace( ForwardIt first, ForwardIt last, const T& old_value,
+					const T& new_value, integral_constant<int, 0> )
+	{
+		for (; first != last; ++first)
+			if (*first == old_value)
+				*first = new_value;
+	}
+
+	template <class It, class T, int Kind>
+	void	__replace( It first, It last, const T& old_value,
+					const T& new_value, integral_constant<int, Kind> )
+	{
+		std::size_t	n = last - first;
+		if (n == 0)
+			return ;
+		// the values may be elements of the range
+		T	o = old_value;
+		T	r = new_value;
+		detail::__replace(detail::__as_int(detail::__to_address(first)), n,
+						detail::__as_int(o), detail::__as_int(r));
+	}
+
+	template <class ForwardIt>
+	ft::pair<ForwardIt, ForwardIt>	__minmax_element( ForwardIt first, ForwardIt last,
+												integral_constant<int, 0> )
+	{
+		ft::pair<ForwardIt, ForwardIt>	res(first, first);
+		if (first == last)
+			return res;
+		while (++first != last)
+		{
+			if (*first < *res.first)
+				res.first = first;
+			else if (!(*first < *res.second))
+				res.second = first;
+		}
+		return res;
+	}
+
+	template <class It>
+	ft::pair<It, It>	__minmax_int( It first, It last, int bias )
+	{
+		std::size_t	n = last - first;
+		if (n == 0)
+			return ft::pair<It, It>(first, first);
+		const int	*p = detail::__as_int(detail::__to_address(first));
+		int			mn, mx;
+		detail::__minmax(p, n, bias, mn, mx);
+		// the first smallest and the last largest, like the loop above
+		return ft::pair<It, It>(first + detail::__find(p, n, mn),
+								first + detail::__find_last(p, n, mx));
+	}
+
+	template <class It>
+	ft::pair<It, It>	__minmax_element( It first, It last, integral_constant<int, 1> )
+	{ return detail::__minmax_int(first, last, 0); }
+
+	template <class It>
+	ft::pair<It, It>	__minmax_element( It first, It last, integral_constant<int, 2> )
+	{ return detail::__minmax_int(first, last, INT_MIN); }
+
+	template <class InputIt, class T>
+	T		__accumulate( InputIt first, InputIt last, T init, integral_constant<int, 0> )
+	{
+		for (; first != last; ++first)
+			init = init + *first;
+		return init;
+	}
+
+	// integer sums don't depend on the order of the additions
+	template <class It, class T>
+	T		__accumulate( It first, It last, T init, integral_constant<int, 1> )
+	{
+		std::size_t	n = last - first;
+		if (n == 0)
+			return init;
+		return static_cast<T>(static_cast<unsigned>(init)
+								+ detail::__sum(detail::__as_int(detail::__to_address(first)), n));
+	}
+
+	template <class It, class T>
+	T		__accumulate( It first, It last, T init, integral_constant<int, 2> )
+	{
+		return detail::__accumulate(first, last, init, integral_constant<int, 1>());
+	}
+}
+
+// The algorithms below run SIMD kernels (AVX2 or SSE2, picked at run time)
+// over contiguous ranges of int, unsigned int and float when the value
+// has the element type; other ranges use the usual loops.
+
+template <class InputIt, class T>
+InputIt	find( InputIt first, InputIt last, const T& value )
+{
+	return detail::__find(first, last, value,
+				integral_constant<int, detail::__algo_dispatch<InputIt, T>::value>());
+}
+
+template <class InputIt, class T>
+typename iterator_traits<InputIt>::difference_type
+	count( InputIt first, InputIt last, const T& value )
+{
+	return detail::__count(first, last, value,
+				integral_constant<int, detail::__algo_dispatch<InputIt, T>::value>());
+}
+
+template <class ForwardIt, class T>
+void	replace( ForwardIt first, ForwardIt last, const T& old_value, const T& new_value )
+{
+	detail::__replace(first, last, old_value, new_value,
+				integral_constant<int, detail::__algo_dispatch<ForwardIt, T>::value>());
+}
+
+// first smallest and last largest element. Float ranges stay on the
+// loop, the order of comparisons matters when they contain NaN.
+template <class ForwardIt>
+ft::pair<ForwardIt, ForwardIt>	minmax_element( ForwardIt first, ForwardIt last )
+{
+	typedef detail::__algo_dispatch<ForwardIt>	kind;
+	return detail::__minmax_element(first, last,
+				integral_constant<int, kind::value == 3 ? 0 : kind::value>());
+}
+
+template <class ForwardIt, class Compare>
+ft::pair<ForwardIt, ForwardIt>	minmax_element( ForwardIt first, ForwardIt last, Compare comp )
+{
+	ft::pair<ForwardIt, ForwardIt>	res(first, first);
+	if (first == last)
+		return res;
+	while (++first != last)
+	{
+		if (comp(*first, *res.first))
+			res.first = first;
+		else if (!comp(*first, *res.second))
+			res.second = first;
+	}
+	return res;
+}
+
+// Integer ranges are summed with SIMD (wrapping like unsigned arithmetic).
+// Float ranges keep the left-to-right order of additions, so the result
+// is the same as with the plain loop.
+template <class InputIt, class T>
+T		accumulate( InputIt first, InputIt last, T init )
+{
+	typedef detail::__algo_dispatch<InputIt, T>	kind;
+	return detail::__accumulate(first, last, init,
+				integral_constant<int, kind::value == 3 ? 0 : kind::value>());
+}
+
+template <class InputIt, class T, class BinaryOperation>
+T		accumulate( InputIt first, InputIt last, T init, BinaryOperation op )
+{
+	for (; first != last; ++first)
+		init = op(init, *first);
+	return init;
+}
+
+
+
+// Sorting
+//
+// sort is a pattern-defeating quicksort: median of three (ninther on
+// big partitions) pivots, sorting networks and insertion sort for small
+// partitions, a bounded insertion sort when a partition was already in
+// order, and heapsort once too many partitions came out unbalanced.
+// Contiguous ranges of integers sorted with the default order go through
+// an LSD radix sort instead, which is also stable.
+
+namespace detail
+{
+	static const std::ptrdiff_t	__insertion_sort_threshold = 24;
+	static const std::ptrdiff_t	__ninther_threshold = 128;
+	static const std::size_t	__partial_insertion_sort_limit = 8;
+	static const std::ptrdiff_t	__radix_sort_threshold = 256;
+
+	template <class T>
+	struct __less
+	{
+		bool	operator()( const T & lhs, const T & rhs ) const
+		{ return lhs < rhs; }
+	};
+
+	// Raw storage for n objects of T, freed (not destroyed) on scope exit
+	template <class T>
+	class __temporary_buffer
+	{
+	public:
+		explicit __temporary_buffer( std::size_t n ) :
+			__data(static_cast<T *>(::operator new(n * sizeof(T))))
+		{}
+
+		~__temporary_buffer()
+		{ ::operator delete(__data); }
+
+		T *	get() const
+		{ return __data; }
+
+	private:
+		__temporary_buffer( const __temporary_buffer & );
+		__temporary_buffer &	operator=( const __temporary_buffer & );
+
+		T	*__data;
+	};
+
+	// radix keys: the unsigned type of the same size, and the bit to flip
+	// so that signed values sort in the unsigned order
+	template <class T>	struct __radix_traits { static const bool value = false; };
+
+	template <class T, class U, bool Signed>
+	struct __radix_key
+	{
+		static const bool	value = true;
+		typedef U			key_type;
+
+		static U	key( T x )
+		{ return static_cast<U>(x) ^ (Signed ? U(1) << (sizeof(U) * CHAR_BIT - 1) : U(0)); }
+	};
+
+	template <>	struct __radix_traits<char> :
+						__radix_key<char, unsigned char, ((char) -1 < 0)> {};
+	template <>	struct __radix_traits<signed char> :
+						__radix_key<signed char, unsigned char, true> {};
+	template <>	struct __radix_traits<unsigned char> :
+						__radix_key<unsigned char, unsigned char, false> {};
+	template <>	struct __radix_traits<short> :
+						__radix_key<short, unsigned short, true> {};
+	template <>	struct __radix_traits<unsigned short> :
+						__radix_key<unsigned short, unsigned short, false> {};
+	template <>	struct __radix_traits<int> :
+						__radix_key<int, unsigned int, true> {};
+	template <>	struct __radix_traits<unsigned int> :
+						__radix_key<unsigned int, unsigned int, false> {};
+	template <>	struct __radix_traits<long> :
+						__radix_key<long, unsigned long, true> {};
+	template <>	struct __radix_traits<unsigned long> :
+						__radix_key<unsigned long, unsigned long, false> {};
+	template <>	struct __radix_traits<long long> :
+						__radix_key<long long, unsigned long long, true> {};
+	template <>	struct __radix_traits<unsigned long long> :
+						__radix_key<unsigned long long, unsigned long long, false> {};
+
+	// sort() and stable_sort() without a comparator take the radix path
+	// for contiguous integer ranges
+	template <class It>
+	struct __use_radix : integral_constant<bool,
+			is_contiguous_iterator<It>::value and is_integral<
+				typename remove_const<typename iterator_traits<It>::value_type>::type>::value
+			and __radix_traits<
+				typename remove_const<typename iterator_traits<It>::value_type>::type>::value>
+	{};
+
+	// sorts one byte per pass, from the least significant; passes where
+	// every key has the same byte are skipped, and input that is already
+	// sorted only costs the scan that finds it out
+	template <class T>
+	void	__radix_sort( T * first, T * last, T * buf )
+	{
+		typedef __radix_traits<T>				traits;
+		typedef typename traits::key_type		key_type;
+		static const std::size_t				passes = sizeof(T);
+
+		T	*cur = first + 1;
+		while (cur != last and not (*cur < *(cur - 1)))
+			++cur;
+		if (cur == last)
+			return ;
+		std::size_t	n = last - first;
+		std::size_t	counts[passes][256] = {};
+		for (T * it = first; it != last; ++it)
+		{
+			key_type	k = traits::key(*it);
+			for (std::size_t p = 0; p < passes; ++p)
+				++counts[p][(k >> (p * 8)) & 0xFF];
+		}
+		T	*src = first;
+		T	*dst = buf;
+		for (std::size_t p = 0; p < passes; ++p)
+		{
+			std::size_t	*count = counts[p];
+			if (count[(traits::key(*src) >> (p * 8)) & 0xFF] == n)
+				continue ;
+			std::size_t	offset = 0;
+			for (std::size_t d = 0; d < 256; ++d)
+			{
+				std::size_t	c = count[d];
+				count[d] = offset;
+				offset += c;
+			}
+			for (T * it = src; it != src + n; ++it)
+				dst[count[(traits::key(*it) >> (p * 8)) & 0xFF]++] = *it;
+			T	*tmp = src;
+			src = dst;
+			dst = tmp;
+		}
+		if (src != first)
+			std::memcpy(first, src, n * sizeof(T));
+	}
+
+	template <class It>
+	void	__radix_sort( It first, It last )
+	{
+		typedef typename remove_const<typename iterator_traits<It>::value_type>::type	T;
+		__temporary_buffer<T>	buf(last - first);
+		T						*p = detail::__to_address(first);
+		detail::__radix_sort(p, p + (last - first), buf.get());
+	}
+
+	// compare-exchange for the sorting networks, branch free for scalars
+	template <class It, class Compare>
+	void	__sort2( It a, It b, Compare comp, true_type )
+	{
+		typename iterator_traits<It>::value_type	x = *a;
+		typename iterator_traits<It>::value_type	y = *b;
+		bool	swapped = comp(y, x);
+		*a = swapped ? y : x;
+		*b = swapped ? x : y;
+	}
+
+	template <class It, class Compare>
+	void	__sort2( It a, It b, Compare comp, false_type )
+	{
+		if (comp(*b, *a))
+			ft::swap(*a, *b);
+	}
+
+	template <class It, class Compare>
+	void	__sort2( It a, It b, Compare comp )
+	{
+		detail::__sort2(a, b, comp, integral_constant<bool, is_trivially_copyable<
+					typename iterator_traits<It>::value_type>::value>());
+	}
+
+	template <class It, class Compare>
+	void	__sort3( It a, It b, It c, Compare comp )
+	{
+		detail::__sort2(a, b, comp);
+		detail::__sort2(b, c, comp);
+		detail::__sort2(a, b, comp);
+	}
+
+	template <class It, class Compare>
+	void	__sort4( It a, It b, It c, It d, Compare comp )
+	{
+		detail::__sort2(a, b, comp);
+		detail::__sort2(c, d, comp);
+		detail::__sort2(a, c, comp);
+		detail::__sort2(b, d, comp);
+		detail::__sort2(b, c, comp);
+	}
+
+	template <class It, class Compare>
+	void	__sort5( It a, It b, It c, It d, It e, Compare comp )
+	{
+		detail::__sort2(a, b, comp);
+		detail::__sort2(d, e, comp);
+		detail::__sort2(c, e, comp);
+		detail::__sort2(c, d, comp);
+		detail::__sort2(b, e, comp);
+		detail::__sort2(a, d, comp);
+		detail::__sort2(a, c, comp);
+		detail::__sort2(b, d, comp);
+		detail::__sort2(b, c, comp);
+	}
+
+	// returns false for ranges the networks don't cover
+	template <class It, class Compare>
+	bool	__sort_network( It first, std::ptrdiff_t n, Compare comp )
+	{
+		switch (n)
+		{
+			case 0:
+			case 1:
+				return true;
+			case 2:
+				detail::__sort2(first, first + 1, comp);
+				return true;
+			case 3:
+				detail::__sort3(first, first + 1, first + 2, comp);
+				return true;
+			case 4:
+				detail::__sort4(first, first + 1, first + 2, first + 3, comp);
+				return true;
+			case 5:
+				detail::__sort5(first, first + 1, first + 2, first + 3, first + 4, comp);
+				return true;
+		}
+		return false;
+	}
+
+	// stable
+	template <class It, class Compare>
+	void	__insertion_sort( It first, It last, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		if (first == last)
+			return ;
+		for (It cur = first + 1; cur != last; ++cur)
+		{
+			It	sift = cur;
+			It	sift_1 = cur - 1;
+			if (comp(*sift, *sift_1))
+			{
+				T	tmp = FT_MOVE(*sift);
+				do
+				{
+					*sift-- = FT_MOVE(*sift_1);
+				}
+				while (sift != first and comp(tmp, *--sift_1));
+				*sift = FT_MOVE(tmp);
+			}
+		}
+	}
+
+	// the element before first is not greater than any in [first, last)
+	template <class It, class Compare>
+	void	__unguarded_insertion_sort( It first, It last, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		if (first == last)
+			return ;
+		for (It cur = first + 1; cur != last; ++cur)
+		{
+			It	sift = cur;
+			It	sift_1 = cur - 1;
+			if (comp(*sift, *sift_1))
+			{
+				T	tmp = FT_MOVE(*sift);
+				do
+				{
+					*sift-- = FT_MOVE(*sift_1);
+				}
+				while (comp(tmp, *--sift_1));
+				*sift = FT_MOVE(tmp);
+			}
+		}
+	}
+
+	// insertion sort that gives up after a few moves, true if it finished
+	template <class It, class Compare>
+	bool	__partial_insertion_sort( It first, It last, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		if (first == last)
+			return true;
+		std::size_t	moves = 0;
+		for (It cur = first + 1; cur != last; ++cur)
+		{
+			It	sift = cur;
+			It	sift_1 = cur - 1;
+			if (comp(*sift, *sift_1))
+			{
+				T	tmp = FT_MOVE(*sift);
+				do
+				{
+					*sift-- = FT_MOVE(*sift_1);
+				}
+				while (sift != first and comp(tmp, *--sift_1));
+				*sift = FT_MOVE(tmp);
+				moves += cur - sift;
+			}
+			if (moves > __partial_insertion_sort_limit)
+				return false;
+		}
+		return true;
+	}
+
+	// heap of [first, first + len), hole at index hole
+	template <class It, class Compare, class T>
+	void	__adjust_heap( It first, std::ptrdiff_t hole, std::ptrdiff_t len,
+						T value, Compare comp )
+	{
+		std::ptrdiff_t	top = hole;
+		std::ptrdiff_t	child = hole;
+		while (child < (len - 1) / 2)
+		{
+			child = 2 * (child + 1);
+			if (comp(first[child], first[child - 1]))
+				--child;
+			first[hole] = FT_MOVE(first[child]);
+			hole = child;
+		}
+		if ((len & 1) == 0 and child == (len - 2) / 2)
+		{
+			child = 2 * (child + 1);
+			first[hole] = FT_MOVE(first[child - 1]);
+			hole = child - 1;
+		}
+		std::ptrdiff_t	parent = (hole - 1) / 2;
+		while (hole > top and comp(first[parent], value))
+		{
+			first[hole] = FT_MOVE(first[parent]);
+			hole = parent;
+			parent = (hole - 1) / 2;
+		}
+		first[hole] = FT_MOVE(value);
+	}
+
+	template <class It, class Compare>
+	void	__make_heap( It first, It last, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		std::ptrdiff_t	len = last - first;
+		if (len < 2)
+			return ;
+		for (std::ptrdiff_t parent = (len - 2) / 2; ; --parent)
+		{
+			T	value = FT_MOVE(first[parent]);
+			detail::__adjust_heap(first, parent, len, FT_MOVE(value), comp);
+			if (parent == 0)
+				return ;
+		}
+	}
+
+	// moves the top of the heap [first, last) to result, the value that
+	// was at result goes into the heap
+	template <class It, class Compare>
+	void	__pop_heap( It first, It last, It result, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		T	value = FT_MOVE(*result);
+		*result = FT_MOVE(*first);
+		detail::__adjust_heap(first, 0, last - first, FT_MOVE(value), comp);
+	}
+
+	template <class It, class Compare>
+	void	__sort_heap( It first, It last, Compare comp )
+	{
+		while (last - first > 1)
+		{
+			--last;
+			detail::__pop_heap(first, last, last, comp);
+		}
+	}
+
+	template <class It, class Compare>
+	void	__heap_sort( It first, It last, Compare comp )
+	{
+		detail::__make_heap(first, last, comp);
+		detail::__sort_heap(first, last, comp);
+	}
+
+	// Partitions [first, last) around *first, elements equal to the pivot
+	// go right. Returns the pivot position and whether the range was
+	// already partitioned.
+	template <class It, class Compare>
+	ft::pair<It, bool>	__partition_right( It begin, It end, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		T	pivot = FT_MOVE(*begin);
+		It	first = begin;
+		It	last = end;
+		// the median of three guarantees an element >= pivot, so the
+		// first scan needs no bound
+		while (comp(*++first, pivot))
+			;
+		if (first - 1 == begin)
+			while (first < last and !comp(*--last, pivot))
+				;
+		else
+			while (!comp(*--last, pivot))
+				;
+		bool	already_partitioned = first >= last;
+		while (first < last)
+		{
+			ft::swap(*first, *last);
+			while (comp(*++first, pivot))
+				;
+			while (!comp(*--last, pivot))
+				;
+		}
+		It	pivot_pos = first - 1;
+		*begin = FT_MOVE(*pivot_pos);
+		*pivot_pos = FT_MOVE(pivot);
+		return ft::pair<It, bool>(pivot_pos, already_partitioned);
+	}
+
+	// Elements equal to the pivot go left. Used when the pivot equals the
+	// element before the range: everything equal to it is then in place.
+	template <class It, class Compare>
+	It		__partition_left( It begin, It end, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		T	pivot = FT_MOVE(*begin);
+		It	first = begin;
+		It	last = end;
+		while (comp(pivot, *--last))
+			;
+		if (last + 1 == end)
+			while (first < last and !comp(pivot, *++first))
+				;
+		else
+			while (!comp(pivot, *++first))
+				;
+		while (first < last)
+		{
+			ft::swap(*first, *last);
+			while (comp(pivot, *--last))
+				;
+			while (!comp(pivot, *++first))
+				;
+		}
+		It	pivot_pos = last;
+		*begin = FT_MOVE(*pivot_pos);
+		*pivot_pos = FT_MOVE(pivot);
+		return pivot_pos;
+	}
+
+	template <class It, class Compare>
+	void	__pdqsort( It begin, It end, Compare comp, int bad_allowed, bool leftmost )
+	{
+		typedef std::ptrdiff_t	diff_t;
+		while (true)
+		{
+			diff_t	size = end - begin;
+			if (size < __insertion_sort_threshold)
+			{
+				if (detail::__sort_network(begin, size, comp))
+					return ;
+				if (leftmost)
+					detail::__insertion_sort(begin, end, comp);
+				else
+					detail::__unguarded_insertion_sort(begin, end, comp);
+				return ;
+			}
+
+			diff_t	s2 = size / 2;
+			if (size > __ninther_threshold)
+			{
+				detail::__sort3(begin, begin + s2, end - 1, comp);
+				detail::__sort3(begin + 1, begin + (s2 - 1), end - 2, comp);
+				detail::__sort3(begin + 2, begin + (s2 + 1), end - 3, comp);
+				detail::__sort3(begin + (s2 - 1), begin + s2, begin + (s2 + 1), comp);
+				ft::swap(*begin, *(begin + s2));
+			}
+			else
+				detail::__sort3(begin + s2, begin, end - 1, comp);
+
+			// the pivot equals an element already placed to the left:
+			// no element of this range is smaller, skip all the equal ones
+			if (!leftmost and !comp(*(begin - 1), *begin))
+			{
+				begin = detail::__partition_left(begin, end, comp) + 1;
+				continue ;
+			}
+
+			ft::pair<It, bool>	part = detail::__partition_right(begin, end, comp);
+			It		pivot_pos = part.first;
+			diff_t	l_size = pivot_pos - begin;
+			diff_t	r_size = end - (pivot_pos + 1);
+
+			if (l_size < size / 8 or r_size < size / 8)
+			{
+				if (--bad_allowed == 0)
+				{
+					detail::__heap_sort(begin, end, comp);
+					return ;
+				}
+				// break the pattern that produced the bad pivot
+				if (l_size >= __insertion_sort_threshold)
+				{
+					ft::swap(*begin, *(begin + l_size / 4));
+					ft::swap(*(pivot_pos - 1), *(pivot_pos - l_size / 4));
+					if (l_size > __ninther_threshold)
+					{
+						ft::swap(*(begin + 1), *(begin + (l_size / 4 + 1)));
+						ft::swap(*(begin + 2), *(begin + (l_size / 4 + 2)));
+						ft::swap(*(pivot_pos - 2), *(pivot_pos - (l_size / 4 + 1)));
+						ft::swap(*(pivot_pos - 3), *(pivot_pos - (l_size / 4 + 2)));
+					}
+				}
+				if (r_size >= __insertion_sort_threshold)
+				{
+					ft::swap(*(pivot_pos + 1), *(pivot_pos + (1 + r_size / 4)));
+					ft::swap(*(end - 1), *(end - r_size / 4));
+					if (r_size > __ninther_threshold)
+					{
+						ft::swap(*(pivot_pos + 2), *(pivot_pos + (2 + r_size / 4)));
+						ft::swap(*(pivot_pos + 3), *(pivot_pos + (3 + r_size / 4)));
+						ft::swap(*(end - 2), *(end - (1 + r_size / 4)));
+						ft::swap(*(end - 3), *(end - (2 + r_size / 4)));
+					}
+				}
+			}
+			else if (part.second
+					and detail::__partial_insertion_sort(begin, pivot_pos, comp)
+					and detail::__partial_insertion_sort(pivot_pos + 1, end, comp))
+				return ;
+
+			detail::__pdqsort(begin, pivot_pos, comp, bad_allowed, leftmost);
+			begin = pivot_pos + 1;
+			leftmost = false;
+		}
+	}
+
+	template <class It, class Compare>
+	void	__sort( It first, It last, Compare comp )
+	{
+		std::ptrdiff_t	n = last - first;
+		int				log2 = 0;
+		while (n >>= 1)
+			++log2;
+		detail::__pdqsort(first, last, comp, log2 + 1, true);
+	}
+
+	template <class It>
+	void	__sort( It first, It last, true_type )
+	{
+		if (last - first >= __radix_sort_threshold)
+			detail::__radix_sort(first, last);
+		else
+			detail::__sort(first, last, __less<typename iterator_traits<It>::value_type>());
+	}
+
+	template <class It>
+	void	__sort( It first, It last, false_type )
+	{
+		detail::__sort(first, last, __less<typename iterator_traits<It>::value_type>());
+	}
+
+	// merges [first, mid) and [mid, last), the first run is moved to buf
+	template <class It, class Compare, class T>
+	void	__merge_with_buffer( It first, It mid, It last, Compare comp, T * buf )
+	{
+		T	*buf_end = buf;
+		try
+		{
+			for (It it = first; it != mid; ++it, ++buf_end)
+				::new (static_cast<void *>(buf_end)) T(FT_MOVE(*it));
+		}
+		catch (...)
+		{
+			detail::__destroy(buf, buf_end);
+			throw ;
+		}
+		T	*b = buf;
+		It	out = first;
+		try
+		{
+			while (b != buf_end and mid != last)
+			{
+				if (comp(*mid, *b))
+					*out++ = FT_MOVE(*mid++);
+				else
+					*out++ = FT_MOVE(*b++);
+			}
+			while (b != buf_end)
+				*out++ = FT_MOVE(*b++);
+		}
+		catch (...)
+		{
+			// put the buffered elements back into the holes
+			while (b != buf_end)
+				*out++ = FT_MOVE(*b++);
+			detail::__destroy(buf, buf_end);
+			throw ;
+		}
+		detail::__destroy(buf, buf_end);
+	}
+
+	template <class It, class Compare, class T>
+	void	__merge_sort( It first, It last, Compare comp, T * buf )
+	{
+		std::ptrdiff_t	n = last - first;
+		if (n <= 32)
+		{
+			detail::__insertion_sort(first, last, comp);
+			return ;
+		}
+		It	mid = first + n / 2;
+		detail::__merge_sort(first, mid, comp, buf);
+		detail::__merge_sort(mid, last, comp, buf);
+		if (comp(*mid, *(mid - 1)))
+			detail::__merge_with_buffer(first, mid, last, comp, buf);
+	}
+
+	template <class It, class Compare>
+	void	__stable_sort( It first, It last, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		std::ptrdiff_t	n = last - first;
+		if (n <= 32)
+		{
+			detail::__insertion_sort(first, last, comp);
+			return ;
+		}
+		__temporary_buffer<T>	buf(n / 2);
+		detail::__merge_sort(first, last, comp, buf.get());
+	}
+
+	template <class It>
+	void	__stable_sort( It first, It last, true_type )
+	{
+		if (last - first >= __radix_sort_threshold)
+			detail::__radix_sort(first, last);
+		else
+			detail::__stable_sort(first, last,
+								__less<typename iterator_traits<It>::value_type>());
+	}
+
+	template <class It>
+	void	__stable_sort( It first, It last, false_type )
+	{
+		detail::__stable_sort(first, last, __less<typename iterator_traits<It>::value_type>());
+	}
+}
+
+template <class RandomIt>
+void	sort( RandomIt first, RandomIt last )
+{
+	detail::__sort(first, last,
+		integral_constant<bool, detail::__use_radix<RandomIt>::value>());
+}
+
+template <class RandomIt, class Compare>
+void	sort( RandomIt first, RandomIt last, Compare comp )
+{
+	detail::__sort(first, last, comp);
+}
+
+// merge sort with a buffer of half the range, radix sort for integers
+template <class RandomIt>
+void	stable_sort( RandomIt first, RandomIt last )
+{
+	detail::__stable_sort(first, last,
+		integral_constant<bool, detail::__use_radix<RandomIt>::value>());
+}
+
+template <class RandomIt, class Compare>
+void	stable_sort( RandomIt first, RandomIt last, Compare comp )
+{
+	detail::__stable_sort(first, last, comp);
+}
+
+// heap selection of the smallest elements, then heapsort of them
+template <class RandomIt, class Compare>
+void	partial_sort( RandomIt first, RandomIt middle, RandomIt last, Compare comp )
+{
+	if (first == middle)
+		return ;
+	detail::__make_heap(first, middle, comp);
+	for (RandomIt it = middle; it != last; ++it)
+		if (comp(*it, *first))
+			detail::__pop_heap(first, middle, it, comp);
+	detail::__sort_heap(first, middle, comp);
+}
+
+template <class RandomIt>
+void	partial_sort( RandomIt first, RandomIt middle, RandomIt last )
+{
+	ft::partial_sort(first, middle, last,
+				detail::__less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+
+
+
+// Searching
+//
+// The binary searches halve the range without branching on the outcome
+// of the comparison: the new base is picked with a conditional move, so
+// there is nothing to mispredict, and both candidates for the next
+// midpoint are prefetched while the current one is compared.
+// interpolation_search guesses the position from the key values instead
+// and needs about log log n probes on uniformly distributed integers.
+
+namespace detail
+{
+	static const std::ptrdiff_t	__interpolation_threshold = 64;
+
+	// narrows (lo, hi] with the key at probe, if probe is inside it
+	template <class RandomIt, class Distance, class T>
+	void	__interpolation_probe( RandomIt first, Distance probe, const T & value,
+				Distance & lo, Distance & hi, double & left, double & right )
+	{
+		if (probe <= lo or probe >= hi)
+			return ;
+		if (*(first + probe) < value)
+		{
+			lo = probe;
+			left = static_cast<double>(*(first + lo));
+		}
+		else
+		{
+			hi = probe;
+			right = static_cast<double>(*(first + hi));
+		}
+	}
+
+	struct __less_any
+	{
+		template <class T, class U>
+		bool	operator()( const T & lhs, const U & rhs ) const
+		{ return lhs < rhs; }
+	};
+
+	template <class T, class Compare>
+	struct __below
+	{
+		const T &	value;
+		Compare		comp;
+
+		__below( const T & value, Compare comp ) : value(value), comp(comp) {}
+
+		template <class U>
+		bool	operator()( const U & x ) const
+		{ return comp(x, value); }
+	};
+
+	template <class T, class Compare>
+	struct __not_above
+	{
+		const T &	value;
+		Compare		comp;
+
+		__not_above( const T & value, Compare comp ) : value(value), comp(comp) {}
+
+		template <class U>
+		bool	operator()( const U & x ) const
+		{ return not comp(value, x); }
+	};
+
+	// first element of [first, first + n) for which pred is false, pred
+	// being true on a prefix of the range
+	template <class It, class Pred>
+	It	__partition_point( It first, typename iterator_traits<It>::difference_type n,
+							Pred pred )
+	{
+		typedef typename iterator_traits<It>::difference_type	difference_type;
+
+		if (n == 0)
+			return first;
+		while (n > 1)
+		{
+			difference_type	half = n / 2;
+			n -= half;
+			detail::__prefetch(&*(first + n / 2));
+			detail::__prefetch(&*(first + (half + n / 2)));
+			first = pred(*(first + half)) ? first + half : first;
+		}
+		return pred(*first) ? first + 1 : first;
+	}
+}
+
+template <class RandomIt, class T, class Compare>
+RandomIt	lower_bound( RandomIt first, RandomIt last, const T & value, Compare comp )
+{
+	return detail::__partition_point(first, last - first,
+									detail::__below<T, Compare>(value, comp));
+}
+
+template <class RandomIt, class T>
+RandomIt	lower_bound( RandomIt first, RandomIt last, const T & value )
+{
+	return ft::lower_bound(first, last, value, detail::__less_any());
+}
+
+template <class RandomIt, class T, class Compare>
+RandomIt	upper_bound( RandomIt first, RandomIt last, const T & value, Compare comp )
+{
+	return detail::__partition_point(first, last - first,
+									detail::__not_above<T, Compare>(value, comp));
+}
+
+template <class RandomIt, class T>
+RandomIt	upper_bound( RandomIt first, RandomIt last, const T & value )
+{
+	return ft::upper_bound(first, last, value, detail::__less_any());
+}
+
+template <class RandomIt, class T, class Compare>
+ft::pair<RandomIt, RandomIt>
+	equal_range( RandomIt first, RandomIt last, const T & value, Compare comp )
+{
+	RandomIt	lower = ft::lower_bound(first, last, value, comp);
+	return ft::pair<RandomIt, RandomIt>(lower, ft::upper_bound(lower, last, value, comp));
+}
+
+template <class RandomIt, class T>
+ft::pair<RandomIt, RandomIt>	equal_range( RandomIt first, RandomIt last, const T & value )
+{
+	return ft::equal_range(first, last, value, detail::__less_any());
+}
+
+template <class RandomIt, class T, class Compare>
+bool	binary_search( RandomIt first, RandomIt last, const T & value, Compare comp )
+{
+	first = ft::lower_bound(first, last, value, comp);
+	return first != last and not comp(value, *first);
+}
+
+template <class RandomIt, class T>
+bool	binary_search( RandomIt first, RandomIt last, const T & value )
+{
+	return ft::binary_search(first, last, value, detail::__less_any());
+}
+
+// lower_bound for sorted integer keys: each probe lands where the value
+// would be if the keys were evenly spread between the two closest keys
+// seen so far, and a second probe a 64th of the range further bounds the
+// other side. A step that does not at least halve the range is followed
+// by a bisection, so skewed keys cost at most about three times a binary
+// search.
+template <class RandomIt, class T>
+RandomIt	interpolation_search( RandomIt first, RandomIt last, const T & value )
+{
+	typedef typename iterator_traits<RandomIt>::difference_type	difference_type;
+
+	if (first == last or not (*first < value))
+		return first;
+	if (*(last - 1) < value)
+		return last;
+	// *(first + lo) < value <= *(first + hi), the answer is in (lo, hi]
+	difference_type	lo = 0;
+	difference_type	hi = last - first - 1;
+	double			left = static_cast<double>(*first);
+	double			right = static_cast<double>(*(last - 1));
+	while (hi - lo > detail::__interpolation_threshold)
+	{
+		difference_type	size = hi - lo;
+		double			ratio = (static_cast<double>(value) - left) / (right - left);
+		// keys rounded to the same double give 0 / 0 or x / 0
+		if (not (ratio >= 0.0))
+			ratio = 0.0;
+		if (ratio > 1.0)
+			ratio = 1.0;
+		difference_type	pos = lo + static_cast<difference_type>(ratio * size);
+		pos = ft::min(ft::max(pos, lo + 1), hi - 1);
+		difference_type	guard = size / detail::__interpolation_threshold + 1;
+		detail::__interpolation_probe(first, pos, value, lo, hi, left, right);
+		detail::__interpolation_probe(first, lo == pos ? pos + guard : pos - guard,
+									value, lo, hi, left, right);
+		if ((hi - lo) * 2 > size)
+			detail::__interpolation_probe(first, lo + (hi - lo) / 2,
+										value, lo, hi, left, right);
+	}
+	return ft::lower_bound(first + (lo + 1), first + hi, value);
+}
+
+} // namespace ft
+
+#endif // FT_ALGORITHM_HPP
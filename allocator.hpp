@@ -0,0 +1,323 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   allocator.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 18:40:27 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 18:40:27 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_ALLOCATOR_HPP
+# define FT_ALLOCATOR_HPP
+
+# include <new>
+# include <cstddef>
+# include <cstdlib>
+# include <cstring>
+# include <limits>
+# include <sys/mman.h>
+# include <unistd.h>
+# include "utility.hpp"
+
+namespace ft
+{
+
+namespace detail
+{
+	inline std::size_t	__page_size()
+	{
+		static std::size_t	size = sysconf(_SC_PAGESIZE);
+		return size;
+	}
+
+	inline std::size_t	__round_to_pages( std::size_t bytes )
+	{
+		std::size_t	page = __page_size();
+		return (bytes + page - 1) & ~(page - 1);
+	}
+
+	inline void *	__map_pages( std::size_t bytes )
+	{
+		void	*p = mmap(NULL, __round_to_pages(bytes), PROT_READ | PROT_WRITE,
+						MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (p == MAP_FAILED)
+			throw std::bad_alloc();
+		return p;
+	}
+
+	inline void	__unmap_pages( void * p, std::size_t bytes )
+	{
+		munmap(p, __round_to_pages(bytes));
+	}
+
+	// size of a transparent huge page on x86-64 and most aarch64 kernels
+	static const std::size_t	__huge_page_size = 2 * 1024 * 1024;
+
+	inline std::size_t	__round_to_huge_pages( std::size_t bytes )
+	{
+		return (bytes + __huge_page_size - 1) & ~(__huge_page_size - 1);
+	}
+
+	// maps whole huge pages starting on a huge page boundary and asks the
+	// kernel to back them with transparent huge pages
+	inline void *	__map_huge_pages( std::size_t bytes )
+	{
+		std::size_t	size = __round_to_huge_pages(bytes);
+		// over-map by one huge page and cut off what is outside the aligned window
+		char	*raw = static_cast<char *>(mmap(NULL, size + __huge_page_size,
+									PROT_READ | PROT_WRITE,
+									MAP_PRIVATE | MAP_ANONYMOUS, -1, 0));
+		if (raw == MAP_FAILED)
+			throw std::bad_alloc();
+		std::size_t	addr = reinterpret_cast<std::size_t>(raw);
+		char		*p = raw + (((addr + __huge_page_size - 1)
+								& ~(__huge_page_size - 1)) - addr);
+		if (p != raw)
+			munmap(raw, p - raw);
+		munmap(p + size, raw + __huge_page_size - p);
+# ifdef MADV_HUGEPAGE
+		madvise(p, size, MADV_HUGEPAGE);
+# endif
+		return p;
+	}
+
+	inline void	__unmap_huge_pages( void * p, std::size_t bytes )
+	{
+		munmap(p, __round_to_huge_pages(bytes));
+	}
+}
+
+// Allocator with a reallocate() hook: ft::vector grows trivially relocatable
+// elements in place through it instead of allocate + copy + deallocate.
+// Blocks of at least MmapThreshold bytes are mapped directly, so growing
+// them remaps pages (mremap) and never touches the data.
+template <class T, std::size_t MmapThreshold = 1024 * 1024>
+class realloc_allocator
+{
+public:
+	typedef T					value_type;
+	typedef T *					pointer;
+	typedef const T *			const_pointer;
+	typedef T &					reference;
+	typedef const T &			const_reference;
+	typedef std::size_t			size_type;
+	typedef std::ptrdiff_t		difference_type;
+
+	template <class U>
+	struct rebind
+	{ typedef realloc_allocator<U, MmapThreshold> other; };
+
+	realloc_allocator() {}
+
+	realloc_allocator( const realloc_allocator & ) {}
+
+	template <class U>
+	realloc_allocator( const realloc_allocator<U, MmapThreshold> & ) {}
+
+	pointer	allocate( size_type n, const void * = 0 )
+	{
+		if (n > max_size())
+			throw std::bad_alloc();
+		std::size_t	bytes = n * sizeof(T);
+		if (bytes >= MmapThreshold)
+			return static_cast<pointer>(detail::__map_pages(bytes));
+		void	*p = std::malloc(bytes ? bytes : 1);
+		if (p == NULL)
+			throw std::bad_alloc();
+		return static_cast<pointer>(p);
+	}
+
+	void	deallocate( pointer p, size_type n )
+	{
+		if (p == NULL)
+			return ;
+		if (n * sizeof(T) >= MmapThreshold)
+			detail::__unmap_pages(p, n * sizeof(T));
+		else
+			std::free(p);
+	}
+
+	// only valid for trivially relocatable T, the bytes are moved as they are
+	pointer	reallocate( pointer p, size_type old_n, size_type new_n )
+	{
+		if (p == NULL)
+			return allocate(new_n);
+		if (new_n > max_size())
+			throw std::bad_alloc();
+		std::size_t	old_bytes = old_n * sizeof(T);
+		std::size_t	new_bytes = new_n * sizeof(T);
+		bool		old_mapped = old_bytes >= MmapThreshold;
+		bool		new_mapped = new_bytes >= MmapThreshold;
+		if (not old_mapped and not new_mapped)
+		{
+			void	*res = std::realloc(p, new_bytes ? new_bytes : 1);
+			if (res == NULL)
+				throw std::bad_alloc();
+			return static_cast<pointer>(res);
+		}
+# ifdef __linux__
+		if (old_mapped and new_mapped)
+		{
+			void	*res = mremap(p, detail::__round_to_pages(old_bytes),
+								detail::__round_to_pages(new_bytes), MREMAP_MAYMOVE);
+			if (res == MAP_FAILED)
+				throw std::bad_alloc();
+			return static_cast<pointer>(res);
+		}
+# endif
+		// crossing the threshold, the block changes kind
+		pointer	res = allocate(new_n);
+		std::memcpy(static_cast<void *>(res), p, ft::min(old_bytes, new_bytes));
+		deallocate(p, old_n);
+		return res;
+	}
+
+	void	construct( pointer p, const T & value )
+	{ ::new (static_cast<void *>(p)) T(value); }
+
+	void	destroy( pointer p )
+	{ p->~T(); }
+
+# if FT_CXX11
+	template <class U, class... Args>
+	void	construct( U * p, Args&&... args )
+	{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+
+	template <class U>
+	void	destroy( U * p )
+	{ p->~U(); }
+# endif
+
+	size_type	max_size() const
+	{ return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+	pointer			address( reference x ) const
+	{ return &x; }
+
+	const_pointer	address( const_reference x ) const
+	{ return &x; }
+};
+
+template <class T1, class T2, std::size_t N>
+bool	operator==( const realloc_allocator<T1, N> &, const realloc_allocator<T2, N> & )
+{
+	return true;
+}
+
+template <class T1, class T2, std::size_t N>
+bool	operator!=( const realloc_allocator<T1, N> &, const realloc_allocator<T2, N> & )
+{
+	return false;
+}
+
+
+// Allocator whose blocks start on an Alignment byte boundary (a power of
+// two), so a vector<float> using 32 or 64 can be processed with aligned
+// SIMD loads from data() on.
+// With HugePages, blocks of 2 MiB or more are mapped on their own, aligned
+// to 2 MiB and advised MADV_HUGEPAGE: the kernel backs them with
+// transparent huge pages, which cuts TLB misses when scanning big arrays.
+template <class T, std::size_t Alignment = 64, bool HugePages = false>
+class aligned_allocator
+{
+	typedef char	__alignment_must_be_a_power_of_two[
+						(Alignment & (Alignment - 1)) == 0 ? 1 : -1];
+public:
+	typedef T					value_type;
+	typedef T *					pointer;
+	typedef const T *			const_pointer;
+	typedef T &					reference;
+	typedef const T &			const_reference;
+	typedef std::size_t			size_type;
+	typedef std::ptrdiff_t		difference_type;
+
+	// posix_memalign wants at least the alignment of a pointer
+	static const std::size_t	alignment = Alignment < sizeof(void *)
+											? sizeof(void *) : Alignment;
+
+	template <class U>
+	struct rebind
+	{ typedef aligned_allocator<U, Alignment, HugePages> other; };
+
+	aligned_allocator() {}
+
+	aligned_allocator( const aligned_allocator & ) {}
+
+	template <class U>
+	aligned_allocator( const aligned_allocator<U, Alignment, HugePages> & ) {}
+
+	pointer	allocate( size_type n, const void * = 0 )
+	{
+		if (n > max_size())
+			throw std::bad_alloc();
+		std::size_t	bytes = n * sizeof(T);
+		if (__is_mapped(bytes))
+			return static_cast<pointer>(detail::__map_huge_pages(bytes));
+		void	*p = NULL;
+		if (posix_memalign(&p, alignment, bytes ? bytes : 1) != 0)
+			throw std::bad_alloc();
+		return static_cast<pointer>(p);
+	}
+
+	void	deallocate( pointer p, size_type n )
+	{
+		if (p == NULL)
+			return ;
+		if (__is_mapped(n * sizeof(T)))
+			detail::__unmap_huge_pages(p, n * sizeof(T));
+		else
+			std::free(p);
+	}
+
+	void	construct( pointer p, const T & value )
+	{ ::new (static_cast<void *>(p)) T(value); }
+
+	void	destroy( pointer p )
+	{ p->~T(); }
+
+# if FT_CXX11
+	template <class U, class... Args>
+	void	construct( U * p, Args&&... args )
+	{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+
+	template <class U>
+	void	destroy( U * p )
+	{ p->~U(); }
+# endif
+
+	size_type	max_size() const
+	{ return (std::numeric_limits<size_type>::max() - detail::__huge_page_size) / sizeof(T); }
+
+	pointer			address( reference x ) const
+	{ return &x; }
+
+	const_pointer	address( const_reference x ) const
+	{ return &x; }
+
+private:
+	static bool	__is_mapped( std::size_t bytes )
+	{ return HugePages and bytes >= detail::__huge_page_size; }
+};
+
+template <class T, std::size_t Alignment, bool HugePages>
+const std::size_t	aligned_allocator<T, Alignment, HugePages>::alignment;
+
+template <class T1, class T2, std::size_t A, bool H>
+bool	operator==( const aligned_allocator<T1, A, H> &, const aligned_allocator<T2, A, H> & )
+{
+	return true;
+}
+
+template <class T1, class T2, std::size_t A, bool H>
+bool	operator!=( const aligned_allocator<T1, A, H> &, const aligned_allocator<T2, A, H> & )
+{
+	return false;
+}
+
+
+} // namespace ft
+
+#endif // FT_ALLOCATOR_HPP
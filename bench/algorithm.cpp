@@ -0,0 +1,178 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   algorithm.cpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:03:16 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 17:03:16 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// ft::find, count, replace, minmax_element and accumulate against plain
+// loops, over ints and floats. Values are in [0, 1000) and the searched
+// value is absent, so find scans the whole range. The loops are what the
+// compiler makes of them at the chosen flags, auto-vectorized or not, so
+// build it at -O2 and at -O1 or -O3 to see both sides. Every ft result is
+// checked against its loop.
+//
+//   ./algorithm [elements = 50000000] [passes = 4]
+
+#include <cstdio>
+#include <cstdlib>
+#include "bench.hpp"
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+namespace
+{
+	template <class T>
+	const T	*loop_find( const T *first, const T *last, T value )
+	{
+		for (; first != last; ++first)
+			if (*first == value)
+				break ;
+		return first;
+	}
+
+	template <class T>
+	std::ptrdiff_t	loop_count( const T *first, const T *last, T value )
+	{
+		std::ptrdiff_t	n = 0;
+		for (; first != last; ++first)
+			if (*first == value)
+				++n;
+		return n;
+	}
+
+	template <class T>
+	void	loop_replace( T *first, T *last, T old_value, T new_value )
+	{
+		for (; first != last; ++first)
+			if (*first == old_value)
+				*first = new_value;
+	}
+
+	template <class T>
+	ft::pair<const T *, const T *>	loop_minmax_element( const T *first, const T *last )
+	{
+		ft::pair<const T *, const T *>	res(first, first);
+		if (first == last)
+			return res;
+		while (++first != last)
+		{
+			if (*first < *res.first)
+				res.first = first;
+			else if (not (*first < *res.second))
+				res.second = first;
+		}
+		return res;
+	}
+
+	template <class T>
+	T	loop_accumulate( const T *first, const T *last, T init )
+	{
+		for (; first != last; ++first)
+			init = init + *first;
+		return init;
+	}
+
+	void	expect( bool ok, const char *what )
+	{
+		if (not ok)
+		{
+			std::fprintf(stderr, "%s: ft and loop results differ\n", what);
+			std::exit(1);
+		}
+	}
+
+	template <class T>
+	void	run( const char *type, std::size_t n, std::size_t passes )
+	{
+		ft::vector<T>	v(n);
+		bench::random	next;
+		std::size_t		ops = n * passes;
+		double			start;
+
+		for (std::size_t i = 0; i != n; ++i)
+			v[i] = static_cast<T>(next() % 1000);
+		T			*first = v.data();
+		T			*last = first + n;
+		const T		absent = static_cast<T>(-1);
+		const T		*found = NULL;
+		const T		*loop_found = NULL;
+
+		std::printf("%zu %s x %zu passes\n", n, type, passes);
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			found = ft::find(first, last, absent);
+		bench::report("ft::find", bench::now() - start, ops);
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			loop_found = loop_find<T>(first, last, absent);
+		bench::report("loop find", bench::now() - start, ops);
+		expect(found == loop_found, "find");
+
+		std::ptrdiff_t	counted = 0;
+		std::ptrdiff_t	loop_counted = 0;
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			counted += ft::count(first, last, static_cast<T>(p));
+		bench::report("ft::count", bench::now() - start, ops);
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			loop_counted += loop_count<T>(first, last, static_cast<T>(p));
+		bench::report("loop count", bench::now() - start, ops);
+		expect(counted == loop_counted, "count");
+
+		// each pair of passes swaps 7 and 1000 and back
+		ft::vector<T>	copy(v);
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			ft::replace(first, last, static_cast<T>(p % 2 ? 1000 : 7), static_cast<T>(p % 2 ? 7 : 1000));
+		bench::report("ft::replace", bench::now() - start, ops);
+		T	*copy_first = copy.data();
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			loop_replace<T>(copy_first, copy_first + n, static_cast<T>(p % 2 ? 1000 : 7),
+				static_cast<T>(p % 2 ? 7 : 1000));
+		bench::report("loop replace", bench::now() - start, ops);
+		expect(v == copy, "replace");
+
+		ft::pair<T *, T *>				minmax(first, first);
+		ft::pair<const T *, const T *>	loop_minmax(first, first);
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			minmax = ft::minmax_element(first, last);
+		bench::report("ft::minmax_element", bench::now() - start, ops);
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			loop_minmax = loop_minmax_element<T>(first, last);
+		bench::report("loop minmax_element", bench::now() - start, ops);
+		expect(minmax.first == loop_minmax.first and minmax.second == loop_minmax.second,
+			"minmax_element");
+
+		T	sum = T();
+		T	loop_sum = T();
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			sum = ft::accumulate(first, last, sum);
+		bench::report("ft::accumulate", bench::now() - start, ops);
+		start = bench::now();
+		for (std::size_t p = 0; p != passes; ++p)
+			loop_sum = loop_accumulate<T>(first, last, loop_sum);
+		bench::report("loop accumulate", bench::now() - start, ops);
+		expect(sum == loop_sum, "accumulate");
+	}
+}
+
+int	main( int argc, char **argv )
+{
+	std::size_t	n = bench::arg(argc, argv, 1, 50000000);
+	std::size_t	passes = bench::arg(argc, argv, 2, 4);
+
+	run<int>("ints", n, passes);
+	run<float>("floats", n, passes);
+	return 0;
+}
@@ -0,0 +1,74 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   bench.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:02:11 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 14:02:11 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_BENCH_HPP
+# define FT_BENCH_HPP
+
+# include <cstddef>
+# include <cstdio>
+# include <cstdlib>
+# include <time.h>
+
+// Shared helpers for the standalone benchmarks in this directory. Each
+// benchmark is a single translation unit with its own main, e.g.
+//   c++ -O2 -pthread -I.. concurrent_stack.cpp
+
+namespace bench
+{
+	inline double	now()
+	{
+		struct timespec	ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return ts.tv_sec + ts.tv_nsec * 1e-9;
+	}
+
+	// argv[i] as a size, or fallback when it is missing
+	inline std::size_t	arg( int argc, char **argv, int i, std::size_t fallback )
+	{
+		if (i < argc)
+			return std::strtoul(argv[i], NULL, 10);
+		return fallback;
+	}
+
+	// keeps the optimizer from dropping a computed value
+	template <class T>
+	inline void	keep( const T & value )
+	{
+		__asm__ __volatile__("" : : "g"(&value) : "memory");
+	}
+
+	inline void	report( const char *name, double seconds, std::size_t ops )
+	{
+		std::printf("  %-28s %9.3f s  %8.2f ns/op\n", name, seconds,
+			ops ? seconds * 1e9 / ops : 0.0);
+	}
+
+	// xorshift64, the same on every platform so runs are comparable
+	struct random
+	{
+		unsigned long long	state;
+
+		explicit random( unsigned long long seed = 88172645463325252ULL ) :
+			state(seed)
+		{}
+
+		unsigned long long	operator()()
+		{
+			state ^= state << 13;
+			state ^= state >> 7;
+			state ^= state << 17;
+			return state;
+		}
+	};
+}
+
+#endif
@@ -0,0 +1,293 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_queue.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:41:05 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 14:41:05 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// ft::spsc_queue and ft::mpmc_queue against a bounded ft::deque behind a
+// pthread mutex. Threads are pinned round robin over the online CPUs and
+// yield when the queue is full or empty, so the numbers stay meaningful
+// when there are fewer cores than threads.
+//
+// - throughput: producers push items between them, consumers pop them all,
+//   one element at a time and then in push_n / pop_n batches
+// - latency: two threads bounce one value through a pair of queues, half
+//   a round trip is reported
+//
+//   ./concurrent_queue [items = 4000000] [batch = 64] [max threads per side = 2]
+
+#include <cstdio>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#include "bench.hpp"
+#include "concurrent_queue.hpp"
+#include "deque.hpp"
+
+namespace
+{
+	const std::size_t	capacity = 1024;
+
+	class locked_queue
+	{
+	public:
+		explicit locked_queue( std::size_t capacity ) : __capacity(capacity)
+		{ pthread_mutex_init(&__mutex, NULL); }
+
+		~locked_queue()
+		{ pthread_mutex_destroy(&__mutex); }
+
+		bool	try_push( int value )
+		{ return push_n(&value, 1) == 1; }
+
+		bool	try_pop( int & out )
+		{ return pop_n(&out, 1) == 1; }
+
+		std::size_t	push_n( const int *first, std::size_t n )
+		{
+			pthread_mutex_lock(&__mutex);
+			n = ft::min(n, __capacity - __queue.size());
+			for (std::size_t i = 0; i != n; ++i)
+				__queue.push_back(first[i]);
+			pthread_mutex_unlock(&__mutex);
+			return n;
+		}
+
+		std::size_t	pop_n( int *out, std::size_t n )
+		{
+			pthread_mutex_lock(&__mutex);
+			n = ft::min(n, __queue.size());
+			for (std::size_t i = 0; i != n; ++i)
+			{
+				out[i] = __queue.front();
+				__queue.pop_front();
+			}
+			pthread_mutex_unlock(&__mutex);
+			return n;
+		}
+
+	private:
+		pthread_mutex_t		__mutex;
+		ft::deque<int>		__queue;
+		std::size_t			__capacity;
+	};
+
+	void	pin( std::size_t thread )
+	{
+		long		cpus = sysconf(_SC_NPROCESSORS_ONLN);
+		cpu_set_t	set;
+
+		CPU_ZERO(&set);
+		CPU_SET(thread % (cpus > 0 ? cpus : 1), &set);
+		pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+	}
+
+	template <class Queue>
+	struct job
+	{
+		Queue				*queue;
+		std::size_t			cpu;
+		std::size_t			items;
+		std::size_t			batch;
+		std::size_t			*popped;	// shared by the consumers
+		long				sum;
+	};
+
+	template <class Queue>
+	void	*produce( void *arg )
+	{
+		job<Queue>	&j = *static_cast<job<Queue> *>(arg);
+		int			values[4096];
+
+		pin(j.cpu);
+		for (std::size_t i = 0; i != j.batch; ++i)
+			values[i] = static_cast<int>(i);
+		for (std::size_t left = j.items; left != 0; )
+		{
+			std::size_t	done;
+			if (j.batch == 1)
+				done = j.queue->try_push(static_cast<int>(left)) ? 1 : 0;
+			else
+				done = j.queue->push_n(values, ft::min(j.batch, left));
+			if (done == 0)
+				sched_yield();
+			left -= done;
+		}
+		return NULL;
+	}
+
+	template <class Queue>
+	void	*consume( void *arg )
+	{
+		job<Queue>	&j = *static_cast<job<Queue> *>(arg);
+		int			values[4096];
+
+		pin(j.cpu);
+		while (__atomic_load_n(j.popped, __ATOMIC_RELAXED) < j.items)
+		{
+			std::size_t	done;
+			if (j.batch == 1)
+				done = j.queue->try_pop(values[0]) ? 1 : 0;
+			else
+				done = j.queue->pop_n(values, j.batch);
+			if (done == 0)
+			{
+				sched_yield();
+				continue ;
+			}
+			for (std::size_t i = 0; i != done; ++i)
+				j.sum += values[i];
+			__atomic_add_fetch(j.popped, done, __ATOMIC_RELAXED);
+		}
+		return NULL;
+	}
+
+	template <class Queue>
+	double	throughput( Queue & queue, std::size_t producers, std::size_t consumers,
+				std::size_t items, std::size_t batch )
+	{
+		pthread_t		ids[64];
+		job<Queue>		jobs[64];
+		std::size_t		popped = 0;
+		std::size_t		threads = producers + consumers;
+
+		items -= items % producers;
+		double	start = bench::now();
+		for (std::size_t i = 0; i != threads; ++i)
+		{
+			jobs[i].queue = &queue;
+			jobs[i].cpu = i;
+			jobs[i].items = i < producers ? items / producers : items;
+			jobs[i].batch = batch;
+			jobs[i].popped = &popped;
+			jobs[i].sum = 0;
+			pthread_create(&ids[i], NULL,
+				i < producers ? &produce<Queue> : &consume<Queue>, &jobs[i]);
+		}
+		for (std::size_t i = 0; i != threads; ++i)
+		{
+			pthread_join(ids[i], NULL);
+			bench::keep(jobs[i].sum);
+		}
+		return bench::now() - start;
+	}
+
+	template <class Queue>
+	struct bounce
+	{
+		Queue				*in;
+		Queue				*out;
+		std::size_t			cpu;
+		std::size_t			rounds;
+		bool				serve;
+	};
+
+	template <class Queue>
+	void	*play( void *arg )
+	{
+		bounce<Queue>	&b = *static_cast<bounce<Queue> *>(arg);
+		int				value = 0;
+
+		pin(b.cpu);
+		for (std::size_t i = 0; i != b.rounds; ++i)
+		{
+			if (b.serve)
+				while (not b.out->try_push(value))
+					sched_yield();
+			while (not b.in->try_pop(value))
+				sched_yield();
+			if (not b.serve)
+				while (not b.out->try_push(value + 1))
+					sched_yield();
+		}
+		bench::keep(value);
+		return NULL;
+	}
+
+	template <class Queue>
+	double	latency( Queue & ping, Queue & pong, std::size_t rounds )
+	{
+		pthread_t		ids[2];
+		bounce<Queue>	sides[2];
+
+		sides[0].in = &pong;
+		sides[0].out = &ping;
+		sides[0].serve = true;
+		sides[1].in = &ping;
+		sides[1].out = &pong;
+		sides[1].serve = false;
+		double	start = bench::now();
+		for (std::size_t i = 0; i != 2; ++i)
+		{
+			sides[i].cpu = i;
+			sides[i].rounds = rounds;
+			pthread_create(&ids[i], NULL, &play<Queue>, &sides[i]);
+		}
+		for (std::size_t i = 0; i != 2; ++i)
+			pthread_join(ids[i], NULL);
+		return bench::now() - start;
+	}
+
+	template <class Queue>
+	void	run_throughput( const char *name, std::size_t producers, std::size_t consumers,
+				std::size_t items, std::size_t batch )
+	{
+		char	label[64];
+
+		{
+			Queue	queue(capacity);
+			std::snprintf(label, sizeof(label), "%s", name);
+			bench::report(label, throughput(queue, producers, consumers, items, 1), items);
+		}
+		{
+			Queue	queue(capacity);
+			std::snprintf(label, sizeof(label), "%s, batch %zu", name, batch);
+			bench::report(label, throughput(queue, producers, consumers, items, batch), items);
+		}
+	}
+
+	template <class Queue>
+	void	run_latency( const char *name, std::size_t rounds )
+	{
+		Queue	ping(capacity);
+		Queue	pong(capacity);
+		bench::report(name, latency(ping, pong, rounds), 2 * rounds);
+	}
+}
+
+int	main( int argc, char **argv )
+{
+	std::size_t	items = bench::arg(argc, argv, 1, 4000000);
+	std::size_t	batch = bench::arg(argc, argv, 2, 64);
+	std::size_t	max_threads = bench::arg(argc, argv, 3, 2);
+
+	batch = ft::max<std::size_t>(1, ft::min<std::size_t>(batch, 4096));
+	max_threads = ft::max<std::size_t>(1, ft::min<std::size_t>(max_threads, 32));
+	std::printf("%ld online cpu(s), capacity %zu\n",
+		sysconf(_SC_NPROCESSORS_ONLN), capacity);
+
+	std::printf("throughput, 1 producer, 1 consumer, %zu items\n", items);
+	run_throughput<ft::spsc_queue<int> >("ft::spsc_queue", 1, 1, items, batch);
+	run_throughput<ft::mpmc_queue<int> >("ft::mpmc_queue", 1, 1, items, batch);
+	run_throughput<locked_queue>("mutex + ft::deque", 1, 1, items, batch);
+	for (std::size_t threads = 2; threads <= max_threads; threads *= 2)
+	{
+		std::printf("throughput, %zu producers, %zu consumers, %zu items\n",
+			threads, threads, items);
+		run_throughput<ft::mpmc_queue<int> >("ft::mpmc_queue", threads, threads, items, batch);
+		run_throughput<locked_queue>("mutex + ft::deque", threads, threads, items, batch);
+	}
+
+	std::size_t	rounds = items / 40;
+	std::printf("latency, %zu round trips\n", rounds);
+	run_latency<ft::spsc_queue<int> >("ft::spsc_queue", rounds);
+	run_latency<ft::mpmc_queue<int> >("ft::mpmc_queue", rounds);
+	run_latency<locked_queue>("mutex + ft::deque", rounds);
+	return 0;
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.cpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 14:09:37 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 14:09:37 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// ft::concurrent_stack against ft::stack behind a pthread mutex. Every
+// thread alternates push and try_pop, so the head is contended the whole
+// run. On a single core the mutex is rarely contended and usually wins.
+//
+//   ./concurrent_stack [max threads = 8] [operations per thread = 1000000]
+
+#include <cstdio>
+#include <pthread.h>
+#include "bench.hpp"
+#include "concurrent_stack.hpp"
+#include "stack.hpp"
+
+namespace
+{
+	class locked_stack
+	{
+	public:
+		locked_stack()
+		{ pthread_mutex_init(&__mutex, NULL); }
+
+		~locked_stack()
+		{ pthread_mutex_destroy(&__mutex); }
+
+		void	push( int value )
+		{
+			pthread_mutex_lock(&__mutex);
+			__stack.push(value);
+			pthread_mutex_unlock(&__mutex);
+		}
+
+		bool	try_pop( int & out )
+		{
+			pthread_mutex_lock(&__mutex);
+			bool	found = not __stack.empty();
+			if (found)
+			{
+				out = __stack.top();
+				__stack.pop();
+			}
+			pthread_mutex_unlock(&__mutex);
+			return found;
+		}
+
+	private:
+		pthread_mutex_t		__mutex;
+		ft::stack<int>		__stack;
+	};
+
+	template <class Stack>
+	struct job
+	{
+		Stack				*stack;
+		std::size_t			ops;
+		long				sum;
+	};
+
+	template <class Stack>
+	void	*run( void *arg )
+	{
+		job<Stack>	&j = *static_cast<job<Stack> *>(arg);
+		int			value;
+
+		for (std::size_t i = 0; i != j.ops; ++i)
+		{
+			j.stack->push(static_cast<int>(i));
+			if (j.stack->try_pop(value))
+				j.sum += value;
+		}
+		return NULL;
+	}
+
+	template <class Stack>
+	double	measure( Stack & stack, std::size_t threads, std::size_t ops )
+	{
+		pthread_t		ids[64];
+		job<Stack>		jobs[64];
+
+		double	start = bench::now();
+		for (std::size_t i = 0; i != threads; ++i)
+		{
+			jobs[i].stack = &stack;
+			jobs[i].ops = ops;
+			jobs[i].sum = 0;
+			pthread_create(&ids[i], NULL, &run<Stack>, &jobs[i]);
+		}
+		for (std::size_t i = 0; i != threads; ++i)
+		{
+			pthread_join(ids[i], NULL);
+			bench::keep(jobs[i].sum);
+		}
+		return bench::now() - start;
+	}
+}
+
+int	main( int argc, char **argv )
+{
+	std::size_t	max_threads = bench::arg(argc, argv, 1, 8);
+	std::size_t	ops = bench::arg(argc, argv, 2, 1000000);
+
+	if (max_threads > 64)
+		max_threads = 64;
+	for (std::size_t threads = 1; threads <= max_threads; threads *= 2)
+	{
+		std::printf("%zu thread(s), %zu push + try_pop each\n", threads, ops);
+		{
+			ft::concurrent_stack<int>	stack(threads);
+			bench::report("ft::concurrent_stack", measure(stack, threads, ops),
+				2 * threads * ops);
+		}
+		{
+			locked_stack	stack;
+			bench::report("mutex + ft::stack", measure(stack, threads, ops),
+				2 * threads * ops);
+		}
+	}
+	return 0;
+}
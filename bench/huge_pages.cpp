@@ -0,0 +1,94 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   huge_pages.cpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 16:27:54 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 16:27:54 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// Scans over ft::vector<float> with aligned_allocator<float, 64, false>
+// against aligned_allocator<float, 64, true>, whose large blocks are
+// advised for transparent huge pages. Three passes per vector:
+// - first touch: resize writes every page, so this is mostly page faults
+// - sequential: a sum over the whole vector, several times
+// - random: a sum of as many loads at random positions, which is where
+//   fewer TLB misses show
+// The AnonHugePages line of /proc/self/smaps_rollup tells whether the
+// kernel actually backed the vector with huge pages.
+//
+//   ./huge_pages [MiB = 1024] [sequential passes = 4]
+
+#include <cstdio>
+#include <cstring>
+#include "bench.hpp"
+#include "allocator.hpp"
+#include "vector.hpp"
+
+namespace
+{
+	void	print_huge_pages()
+	{
+		std::FILE	*f = std::fopen("/proc/self/smaps_rollup", "r");
+		char		line[256];
+
+		if (f == NULL)
+			return ;
+		while (std::fgets(line, sizeof(line), f))
+			if (std::strncmp(line, "AnonHugePages:", 14) == 0)
+				std::printf("  %s", line);
+		std::fclose(f);
+	}
+
+	template <class Allocator>
+	void	run( const char *name, std::size_t n, std::size_t passes )
+	{
+		ft::vector<float, Allocator>	v;
+		double							start;
+		float							sum = 0;
+
+		std::printf("%s\n", name);
+		start = bench::now();
+		v.resize(n, 1.0f);
+		bench::report("first touch", bench::now() - start, n);
+		print_huge_pages();
+
+		// eight partial sums so the adds keep up with memory
+		float	sums[8] = { 0, 0, 0, 0, 0, 0, 0, 0 };
+		start = bench::now();
+		for (std::size_t pass = 0; pass != passes; ++pass)
+			for (std::size_t i = 0; i + 8 <= n; i += 8)
+				for (std::size_t k = 0; k != 8; ++k)
+					sums[k] += v[i + k];
+		for (std::size_t k = 0; k != 8; ++k)
+			sum += sums[k];
+		double	seconds = bench::now() - start;
+		bench::report("sequential", seconds, passes * n);
+		std::printf("  %-28s %9.2f GB/s\n", "", passes * n * sizeof(float) / seconds * 1e-9);
+
+		bench::random	next;
+		start = bench::now();
+		for (std::size_t i = 0; i != n; ++i)
+			sum += v[next() % n];
+		bench::report("random", bench::now() - start, n);
+		bench::keep(sum);
+	}
+}
+
+int	main( int argc, char **argv )
+{
+	std::size_t	mib = bench::arg(argc, argv, 1, 1024);
+	std::size_t	passes = bench::arg(argc, argv, 2, 4);
+	std::size_t	n = mib * 1024 * 1024 / sizeof(float);
+
+	if (n == 0)
+		return 0;
+
+	std::printf("%zu MiB, %zu floats\n", mib, n);
+	run<ft::aligned_allocator<float, 64, false> >("4 KiB pages", n, passes);
+	run<ft::aligned_allocator<float, 64, true> >("huge pages", n, passes);
+	return 0;
+}
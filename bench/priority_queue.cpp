@@ -0,0 +1,155 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.cpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 17:38:42 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 17:38:42 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// ft::priority_queue with 2, 4 and 8 children per node against
+// std::priority_queue, then ft::indexed_priority_queue running Dijkstra
+// on a random graph with the same arities.
+// - heap: n random pushes, n pop + push pairs, then n pops
+// - dijkstra: shortest distances from vertex 0, every relaxation is a
+//   push_or_update; the distances of all arities are checked to agree
+//
+//   ./priority_queue [elements = 2000000] [vertices = 1000000] [edges per vertex = 8]
+
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <queue>
+#include "bench.hpp"
+#include "priority_queue.hpp"
+#include "vector.hpp"
+
+namespace
+{
+	template <class Queue>
+	void	heap( const char *name, std::size_t n )
+	{
+		Queue			queue;
+		bench::random	next;
+		long			sum = 0;
+
+		double	start = bench::now();
+		for (std::size_t i = 0; i != n; ++i)
+			queue.push(static_cast<int>(next() >> 33));
+		for (std::size_t i = 0; i != n; ++i)
+		{
+			sum += queue.top();
+			queue.pop();
+			queue.push(static_cast<int>(next() >> 33));
+		}
+		while (not queue.empty())
+		{
+			sum += queue.top();
+			queue.pop();
+		}
+		bench::report(name, bench::now() - start, 3 * n);
+		bench::keep(sum);
+	}
+
+	// adjacency lists in one array: the edges of v are
+	// [first[v], first[v + 1])
+	struct graph
+	{
+		ft::vector<std::size_t>		first;
+		ft::vector<std::size_t>		target;
+		ft::vector<unsigned int>	weight;
+	};
+
+	void	make_graph( graph & g, std::size_t vertices, std::size_t degree )
+	{
+		bench::random	next;
+
+		g.first.resize(vertices + 1);
+		g.target.resize(vertices * degree);
+		g.weight.resize(vertices * degree);
+		for (std::size_t v = 0; v != vertices; ++v)
+		{
+			g.first[v] = v * degree;
+			for (std::size_t e = v * degree; e != (v + 1) * degree; ++e)
+			{
+				g.target[e] = next() % vertices;
+				g.weight[e] = static_cast<unsigned int>(next() % 1000) + 1;
+			}
+		}
+		g.first[vertices] = vertices * degree;
+	}
+
+	template <std::size_t Arity>
+	void	dijkstra( const char *name, const graph & g, ft::vector<unsigned int> & dist )
+	{
+		typedef ft::indexed_priority_queue<unsigned int, std::greater<unsigned int>, Arity>	queue_type;
+
+		std::size_t		vertices = g.first.size() - 1;
+		queue_type		queue(vertices);
+		const unsigned	unreached = static_cast<unsigned int>(-1);
+
+		double	start = bench::now();
+		dist.assign(vertices, unreached);
+		dist[0] = 0;
+		queue.push(0, 0);
+		while (not queue.empty())
+		{
+			std::size_t		v = queue.top_id();
+			unsigned int	d = queue.top();
+			queue.pop();
+			for (std::size_t e = g.first[v]; e != g.first[v + 1]; ++e)
+			{
+				std::size_t		w = g.target[e];
+				unsigned int	candidate = d + g.weight[e];
+				if (candidate < dist[w])
+				{
+					if (dist[w] == unreached)
+						queue.push(w, candidate);
+					else
+						queue.decrease_key(w, candidate);
+					dist[w] = candidate;
+				}
+			}
+		}
+		bench::report(name, bench::now() - start, g.target.size());
+	}
+}
+
+int	main( int argc, char **argv )
+{
+	std::size_t	n = bench::arg(argc, argv, 1, 2000000);
+	std::size_t	vertices = bench::arg(argc, argv, 2, 1000000);
+	std::size_t	degree = bench::arg(argc, argv, 3, 8);
+
+	std::printf("heap, %zu elements\n", n);
+	heap<ft::priority_queue<int, ft::vector<int>, std::less<int>, 2> >("ft, binary", n);
+	heap<ft::priority_queue<int, ft::vector<int>, std::less<int>, 4> >("ft, 4-ary", n);
+	heap<ft::priority_queue<int, ft::vector<int>, std::less<int>, 8> >("ft, 8-ary", n);
+	heap<std::priority_queue<int> >("std::priority_queue", n);
+
+	if (vertices == 0)
+		return 0;
+	graph						g;
+	ft::vector<unsigned int>	expected;
+	ft::vector<unsigned int>	dist;
+
+	make_graph(g, vertices, degree);
+	std::printf("dijkstra, %zu vertices, %zu edges\n", vertices, g.target.size());
+	dijkstra<2>("indexed, binary", g, expected);
+	dijkstra<4>("indexed, 4-ary", g, dist);
+	if (not (dist == expected))
+	{
+		std::fprintf(stderr, "4-ary distances differ\n");
+		return 1;
+	}
+	dijkstra<8>("indexed, 8-ary", g, dist);
+	if (not (dist == expected))
+	{
+		std::fprintf(stderr, "8-ary distances differ\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,149 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   search.cpp                                         :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:48:20 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 15:48:20 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// ft::lower_bound, ft::upper_bound and ft::interpolation_search against a
+// textbook branchy binary search, for random lookups in sorted arrays of
+// 1K elements up to the given maximum, growing tenfold. The keys are
+// evenly spaced, then spaced by random gaps of 0 or 2 (even on average,
+// with duplicates). 1B elements take 4 GiB. All results are checked
+// against the textbook search.
+//
+//   ./search [max elements = 100000000] [lookups = 2000000]
+
+#include <cstdio>
+#include <cstdlib>
+#include "bench.hpp"
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+namespace
+{
+	typedef unsigned int	key_type;
+
+	const key_type	*textbook_lower_bound( const key_type *first, const key_type *last,
+						key_type value )
+	{
+		while (first < last)
+		{
+			const key_type	*middle = first + (last - first) / 2;
+			if (*middle < value)
+				first = middle + 1;
+			else
+				last = middle;
+		}
+		return first;
+	}
+
+	struct textbook
+	{
+		const key_type	*operator()( const key_type *first, const key_type *last,
+							key_type value ) const
+		{ return textbook_lower_bound(first, last, value); }
+	};
+
+	struct lower
+	{
+		const key_type	*operator()( const key_type *first, const key_type *last,
+							key_type value ) const
+		{ return ft::lower_bound(first, last, value); }
+	};
+
+	struct upper
+	{
+		const key_type	*operator()( const key_type *first, const key_type *last,
+							key_type value ) const
+		{ return ft::upper_bound(first, last, value); }
+	};
+
+	struct interpolation
+	{
+		const key_type	*operator()( const key_type *first, const key_type *last,
+							key_type value ) const
+		{ return ft::interpolation_search(first, last, value); }
+	};
+
+	// the textbook positions, and the textbook time
+	double	reference( const ft::vector<key_type> & v, const ft::vector<key_type> & keys,
+				ft::vector<std::size_t> & positions )
+	{
+		const key_type	*first = v.data();
+		const key_type	*last = first + v.size();
+
+		positions.resize(keys.size());
+		double	start = bench::now();
+		for (std::size_t i = 0; i != keys.size(); ++i)
+			positions[i] = textbook_lower_bound(first, last, keys[i]) - first;
+		return bench::now() - start;
+	}
+
+	template <class Search>
+	void	measure( const char *name, Search search, const ft::vector<key_type> & v,
+				const ft::vector<key_type> & keys, const ft::vector<std::size_t> & positions,
+				bool upper_bound )
+	{
+		const key_type	*first = v.data();
+		const key_type	*last = first + v.size();
+		std::size_t		sum = 0;
+
+		double	start = bench::now();
+		for (std::size_t i = 0; i != keys.size(); ++i)
+			sum += search(first, last, keys[i]) - first;
+		bench::report(name, bench::now() - start, keys.size());
+		bench::keep(sum);
+
+		for (std::size_t i = 0; i != keys.size(); ++i)
+		{
+			std::size_t	expected = positions[i];
+			if (upper_bound)
+				while (expected != v.size() and v[expected] == keys[i])
+					++expected;
+			if (static_cast<std::size_t>(search(first, last, keys[i]) - first) != expected)
+			{
+				std::fprintf(stderr, "%s: wrong position for %u\n", name, keys[i]);
+				std::exit(1);
+			}
+		}
+	}
+}
+
+int	main( int argc, char **argv )
+{
+	std::size_t	max_size = bench::arg(argc, argv, 1, 100000000);
+	std::size_t	lookups = bench::arg(argc, argv, 2, 2000000);
+
+	ft::vector<key_type>	v;
+	ft::vector<key_type>	keys(lookups);
+	ft::vector<std::size_t>	positions;
+	bench::random			next;
+
+	for (std::size_t n = 1000; n <= max_size and n <= 2000000000; n *= 10)
+		for (int gaps = 0; gaps != 2; ++gaps)
+		{
+			v.resize(n);
+			key_type	value = 0;
+			for (std::size_t i = 0; i != n; ++i)
+			{
+				v[i] = value;
+				value += gaps ? next() & 2 : 2;
+			}
+			for (std::size_t i = 0; i != lookups; ++i)
+				keys[i] = static_cast<key_type>(next() % (value + 1));
+
+			std::printf("%zu elements, %s, %zu lookups\n", n,
+				gaps ? "random gaps" : "evenly spaced", lookups);
+			bench::report("textbook lower_bound", reference(v, keys, positions), lookups);
+			measure("ft::lower_bound", lower(), v, keys, positions, false);
+			measure("ft::upper_bound", upper(), v, keys, positions, true);
+			measure("ft::interpolation_search", interpolation(), v, keys, positions, false);
+		}
+	return 0;
+}
@@ -0,0 +1,113 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   sort.cpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 15:12:48 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 15:12:48 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+// ft::sort, ft::stable_sort and ft::partial_sort against their std
+// counterparts, over ints (radix sort path) and doubles (comparison sorts),
+// on random, sorted and reversed inputs. Every result is checked.
+//
+//   ./sort [elements = 10000000]
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "bench.hpp"
+#include "algorithm.hpp"
+#include "vector.hpp"
+
+namespace
+{
+	enum order { random_order, sorted_order, reversed_order };
+
+	const char	*order_names[] = { "random", "sorted", "reversed" };
+
+	template <class T>
+	void	fill( ft::vector<T> & v, std::size_t n, order o )
+	{
+		bench::random	next;
+
+		v.clear();
+		for (std::size_t i = 0; i != n; ++i)
+			v.push_back(static_cast<T>(next() % 1000000000));
+		if (o != random_order)
+			std::sort(v.begin(), v.end());
+		if (o == reversed_order)
+			std::reverse(v.begin(), v.end());
+	}
+
+	template <class T>
+	void	check( const ft::vector<T> & v, std::size_t sorted )
+	{
+		for (std::size_t i = 1; i < sorted; ++i)
+			if (v[i] < v[i - 1])
+			{
+				std::fprintf(stderr, "not sorted at %zu\n", i);
+				std::exit(1);
+			}
+	}
+
+	template <class T>
+	void	run( const char *type, std::size_t n )
+	{
+		ft::vector<T>	input;
+		ft::vector<T>	v;
+		std::size_t		k = n / 100;
+		double			start;
+
+		for (int o = random_order; o <= reversed_order; ++o)
+		{
+			std::printf("%zu %s, %s\n", n, type, order_names[o]);
+			fill(input, n, static_cast<order>(o));
+
+			v = input;
+			start = bench::now();
+			ft::sort(v.begin(), v.end());
+			bench::report("ft::sort", bench::now() - start, n);
+			check(v, n);
+
+			v = input;
+			start = bench::now();
+			std::sort(v.begin(), v.end());
+			bench::report("std::sort", bench::now() - start, n);
+
+			v = input;
+			start = bench::now();
+			ft::stable_sort(v.begin(), v.end());
+			bench::report("ft::stable_sort", bench::now() - start, n);
+			check(v, n);
+
+			v = input;
+			start = bench::now();
+			std::stable_sort(v.begin(), v.end());
+			bench::report("std::stable_sort", bench::now() - start, n);
+
+			v = input;
+			start = bench::now();
+			ft::partial_sort(v.begin(), v.begin() + k, v.end());
+			bench::report("ft::partial_sort (1%)", bench::now() - start, n);
+			check(v, k);
+
+			v = input;
+			start = bench::now();
+			std::partial_sort(v.begin(), v.begin() + k, v.end());
+			bench::report("std::partial_sort (1%)", bench::now() - start, n);
+		}
+	}
+}
+
+int	main( int argc, char **argv )
+{
+	std::size_t	n = bench::arg(argc, argv, 1, 10000000);
+
+	run<int>("ints", n);
+	run<double>("doubles", n);
+	return 0;
+}
@@ -0,0 +1,449 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_queue.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:37:02 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 23:37:02 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_CONCURRENT_QUEUE_HPP
+# define FT_CONCURRENT_QUEUE_HPP
+
+# include <memory>
+# include <cstddef>
+# include <stdexcept>
+# include "utility.hpp"
+# include "thread_pool.hpp"
+
+// Bounded FIFO queues over a ring buffer of a power of two slots,
+// allocated once through Allocator like vector's storage. try_push fails
+// when the queue is full and try_pop when it is empty, they never block
+// and never allocate.
+// The counters written by the producers and the ones written by the
+// consumers live on different cache lines, so the two sides don't slow
+// each other down by invalidating a shared line (false sharing).
+// push_n and pop_n move up to n elements and publish them with one
+// atomic operation instead of one per element.
+
+namespace ft
+{
+
+namespace detail
+{
+	inline std::size_t	__ring_capacity( std::size_t n )
+	{
+		std::size_t	capacity = 2;
+		while (capacity < n)
+			capacity *= 2;
+		return capacity;
+	}
+}
+
+// One producer thread and one consumer thread. Each side only writes its
+// own index and keeps a copy of the other one, which it reloads only when
+// the ring looks full (or empty), so most operations touch no shared line.
+template <class T, class Allocator = std::allocator<T> >
+class spsc_queue
+{
+public:
+	typedef T				value_type;
+	typedef Allocator		allocator_type;
+	typedef std::size_t		size_type;
+
+	// capacity is rounded up to a power of two
+	explicit spsc_queue( size_type capacity, const Allocator& alloc = Allocator() ) :
+		__tail(0), __head_cache(0), __head(0), __tail_cache(0),
+		__capacity(detail::__ring_capacity(capacity)), __mask(__capacity - 1),
+		__alloc(alloc)
+	{
+		__buffer = __alloc.allocate(__capacity);
+	}
+
+	~spsc_queue()
+	{
+		for (; __head != __tail; ++__head)
+			__buffer[__head & __mask].~T();
+		__alloc.deallocate(__buffer, __capacity);
+	}
+
+	// producer side
+	bool	try_push( const T & value )
+	{
+		if (not __room(1))
+			return false;
+		::new (static_cast<void *>(__buffer + (__tail & __mask))) T(value);
+		__atomic_store_n(&__tail, __tail + 1, __ATOMIC_RELEASE);
+		return true;
+	}
+
+# if FT_CXX11
+	bool	try_push( T && value )
+	{ return try_emplace(std::move(value)); }
+
+	template <class... Args>
+	bool	try_emplace( Args&&... args )
+	{
+		if (not __room(1))
+			return false;
+		::new (static_cast<void *>(__buffer + (__tail & __mask))) T(std::forward<Args>(args)...);
+		__atomic_store_n(&__tail, __tail + 1, __ATOMIC_RELEASE);
+		return true;
+	}
+# endif
+
+	// pushes the first elements of [first, first + n) that fit, returns
+	// how many. If a copy throws, the ones before it stay pushed.
+	template <class InputIt>
+	size_type	push_n( InputIt first, size_type n )
+	{
+		n = ft::min(n, __room(n));
+		size_type	done = 0;
+		try
+		{
+			for (; done != n; ++done, ++first)
+				::new (static_cast<void *>(__buffer + ((__tail + done) & __mask))) T(*first);
+		}
+		catch (...)
+		{
+			__atomic_store_n(&__tail, __tail + done, __ATOMIC_RELEASE);
+			throw ;
+		}
+		__atomic_store_n(&__tail, __tail + n, __ATOMIC_RELEASE);
+		return n;
+	}
+
+	// consumer side; if the assignment throws the element stays queued
+	bool	try_pop( T & out )
+	{
+		if (__ready(1) == 0)
+			return false;
+		T	*slot = __buffer + (__head & __mask);
+		out = FT_MOVE(*slot);
+		slot->~T();
+		__atomic_store_n(&__head, __head + 1, __ATOMIC_RELEASE);
+		return true;
+	}
+
+	// moves up to n elements to out, returns how many
+	template <class OutputIt>
+	size_type	pop_n( OutputIt out, size_type n )
+	{
+		n = __ready(n);
+		size_type	done = 0;
+		try
+		{
+			for (; done != n; ++done, ++out)
+			{
+				T	*slot = __buffer + ((__head + done) & __mask);
+				*out = FT_MOVE(*slot);
+				slot->~T();
+			}
+		}
+		catch (...)
+		{
+			__atomic_store_n(&__head, __head + done, __ATOMIC_RELEASE);
+			throw ;
+		}
+		__atomic_store_n(&__head, __head + n, __ATOMIC_RELEASE);
+		return n;
+	}
+
+	// a snapshot when the other side is running
+	size_type	size() const
+	{
+		return __atomic_load_n(&__tail, __ATOMIC_ACQUIRE)
+				- __atomic_load_n(&__head, __ATOMIC_ACQUIRE);
+	}
+
+	bool	empty() const
+	{ return size() == 0; }
+
+	size_type	capacity() const
+	{ return __capacity; }
+
+private:
+	spsc_queue( const spsc_queue & );
+	spsc_queue &	operator=( const spsc_queue & );
+
+	// free slots, the consumer index is reloaded if fewer than wanted
+	size_type	__room( size_type wanted )
+	{
+		size_type	room = __capacity - (__tail - __head_cache);
+		if (room < wanted)
+		{
+			__head_cache = __atomic_load_n(&__head, __ATOMIC_ACQUIRE);
+			room = __capacity - (__tail - __head_cache);
+		}
+		return ft::min(room, wanted);
+	}
+
+	size_type	__ready( size_type wanted )
+	{
+		size_type	ready = __tail_cache - __head;
+		if (ready < wanted)
+		{
+			__tail_cache = __atomic_load_n(&__tail, __ATOMIC_ACQUIRE);
+			ready = __tail_cache - __head;
+		}
+		return ft::min(ready, wanted);
+	}
+
+private:
+	// producer line
+	size_type	__tail;
+	size_type	__head_cache;
+	char		__pad0[detail::__cache_line - 2 * sizeof(size_type)];
+	// consumer line
+	size_type	__head;
+	size_type	__tail_cache;
+	char		__pad1[detail::__cache_line - 2 * sizeof(size_type)];
+	// read only
+	T			*__buffer;
+	size_type	__capacity;
+	size_type	__mask;
+	Allocator	__alloc;
+};
+
+
+// Any number of producers and consumers (Vyukov's bounded queue). Each
+// slot carries a sequence number telling which lap of the ring it is on:
+// it equals the position when the slot is free for the producer of that
+// position, and the position + 1 once the element is there for the
+// consumer. A thread claims positions with one compare-and-swap on the
+// shared counter of its side, then waits on nothing: the slot's sequence
+// already told it was its turn.
+template <class T, class Allocator = std::allocator<T> >
+class mpmc_queue
+{
+private:
+	struct __slot_type
+	{
+		std::size_t					sequence;
+		// false when the push that claimed the slot threw: the consumer
+		// skips it
+		bool						full;
+		aligned_buffer<sizeof(T), alignment_of<T>::value>	value;
+	};
+
+	typedef typename Allocator::template rebind<__slot_type>::other	__slot_allocator;
+
+public:
+	typedef T				value_type;
+	typedef Allocator		allocator_type;
+	typedef std::size_t		size_type;
+
+	// capacity is rounded up to a power of two
+	explicit mpmc_queue( size_type capacity, const Allocator& alloc = Allocator() ) :
+		__enqueue(0), __dequeue(0),
+		__capacity(detail::__ring_capacity(capacity)), __mask(__capacity - 1),
+		__alloc(alloc)
+	{
+		__slots = __alloc.allocate(__capacity);
+		for (size_type i = 0; i != __capacity; ++i)
+			__slots[i].sequence = i;
+	}
+
+	// not thread safe
+	~mpmc_queue()
+	{
+		for (; __dequeue != __enqueue; ++__dequeue)
+		{
+			__slot_type	&slot = __slots[__dequeue & __mask];
+			if (slot.full)
+				__value(slot)->~T();
+		}
+		__alloc.deallocate(__slots, __capacity);
+	}
+
+	bool	try_push( const T & value )
+	{ return push_n(&value, 1) == 1; }
+
+# if FT_CXX11
+	bool	try_push( T && value )
+	{ return try_emplace(std::move(value)); }
+
+	template <class... Args>
+	bool	try_emplace( Args&&... args )
+	{
+		size_type	pos;
+		if (__claim(__enqueue, 0, 1, pos) == 0)
+			return false;
+		__slot_type	&slot = __slots[pos & __mask];
+		slot.full = false;
+		try
+		{
+			::new (static_cast<void *>(__value(slot))) T(std::forward<Args>(args)...);
+			slot.full = true;
+		}
+		catch (...)
+		{
+			__atomic_store_n(&slot.sequence, pos + 1, __ATOMIC_RELEASE);
+			throw ;
+		}
+		__atomic_store_n(&slot.sequence, pos + 1, __ATOMIC_RELEASE);
+		return true;
+	}
+# endif
+
+	// pushes the first elements of [first, first + n) that fit, returns
+	// how many. If a copy throws, the ones before it stay pushed.
+	template <class InputIt>
+	size_type	push_n( InputIt first, size_type n )
+	{
+		size_type	pos;
+		n = __claim(__enqueue, 0, n, pos);
+		size_type	done = 0;
+		try
+		{
+			for (; done != n; ++done, ++first)
+			{
+				__slot_type	&slot = __slots[(pos + done) & __mask];
+				slot.full = false;
+				::new (static_cast<void *>(__value(slot))) T(*first);
+				slot.full = true;
+				__atomic_store_n(&slot.sequence, pos + done + 1, __ATOMIC_RELEASE);
+			}
+		}
+		catch (...)
+		{
+			// the claimed slots are handed over empty
+			for (; done != n; ++done)
+			{
+				__slot_type	&slot = __slots[(pos + done) & __mask];
+				slot.full = false;
+				__atomic_store_n(&slot.sequence, pos + done + 1, __ATOMIC_RELEASE);
+			}
+			throw ;
+		}
+		return n;
+	}
+
+	// if the assignment throws the element is lost
+	bool	try_pop( T & out )
+	{
+		size_type	moved = 0;
+		while (__pop_n(&out, 1, moved) != 0 and moved == 0)
+			;
+		return moved != 0;
+	}
+
+	// moves up to n elements to out, returns how many; 0 when the queue
+	// was seen empty, or all the slots claimed were left empty by a push
+	// that threw. If an assignment throws, the elements claimed by this
+	// call that were not moved yet are lost.
+	template <class OutputIt>
+	size_type	pop_n( OutputIt out, size_type n )
+	{
+		size_type	moved = 0;
+		__pop_n(out, n, moved);
+		return moved;
+	}
+
+	// a snapshot when other threads are pushing or popping
+	size_type	size() const
+	{
+		size_type	dequeue = __atomic_load_n(&__dequeue, __ATOMIC_ACQUIRE);
+		size_type	enqueue = __atomic_load_n(&__enqueue, __ATOMIC_ACQUIRE);
+		return enqueue > dequeue ? enqueue - dequeue : 0;
+	}
+
+	bool	empty() const
+	{ return size() == 0; }
+
+	size_type	capacity() const
+	{ return __capacity; }
+
+private:
+	mpmc_queue( const mpmc_queue & );
+	mpmc_queue &	operator=( const mpmc_queue & );
+
+	static T *	__value( __slot_type & slot )
+	{ return reinterpret_cast<T *>(slot.value.data); }
+
+	// returns how many positions it claimed; moved counts the elements
+	// actually moved, fewer when some slots were left empty
+	template <class OutputIt>
+	size_type	__pop_n( OutputIt out, size_type n, size_type & moved )
+	{
+		size_type	pos;
+		n = __claim(__dequeue, 1, n, pos);
+		size_type	done = 0;
+		try
+		{
+			for (; done != n; ++done)
+			{
+				__slot_type	&slot = __slots[(pos + done) & __mask];
+				if (slot.full)
+				{
+					T	*value = __value(slot);
+					*out = FT_MOVE(*value);
+					++out;
+					++moved;
+					value->~T();
+				}
+				__atomic_store_n(&slot.sequence, pos + done + __capacity, __ATOMIC_RELEASE);
+			}
+		}
+		catch (...)
+		{
+			for (; done != n; ++done)
+			{
+				__slot_type	&slot = __slots[(pos + done) & __mask];
+				if (slot.full)
+					__value(slot)->~T();
+				__atomic_store_n(&slot.sequence, pos + done + __capacity, __ATOMIC_RELEASE);
+			}
+			throw ;
+		}
+		return n;
+	}
+
+	// claims up to n consecutive positions of counter whose slots are
+	// ready (sequence == position + lag), returns how many, 0 when the
+	// ring is full (producers, lag 0) or empty (consumers, lag 1)
+	size_type	__claim( size_type & counter, size_type lag, size_type n, size_type & pos )
+	{
+		pos = __atomic_load_n(&counter, __ATOMIC_RELAXED);
+		for (;;)
+		{
+			size_type	ready = 0;
+			while (ready != n and __atomic_load_n(&__slots[(pos + ready) & __mask].sequence,
+										__ATOMIC_ACQUIRE) == pos + ready + lag)
+				++ready;
+			if (ready == 0)
+			{
+				std::ptrdiff_t	lap = __atomic_load_n(&__slots[pos & __mask].sequence,
+										__ATOMIC_ACQUIRE) - (pos + lag);
+				// the slot is a lap behind: full, or empty
+				if (lap < 0)
+					return 0;
+				// another thread took pos
+				pos = __atomic_load_n(&counter, __ATOMIC_RELAXED);
+				continue ;
+			}
+			// no ABA: the counters only grow
+			if (__atomic_compare_exchange_n(&counter, &pos, pos + ready, true,
+											__ATOMIC_RELAXED, __ATOMIC_RELAXED))
+				return ready;
+			detail::__cpu_relax();
+		}
+	}
+
+private:
+	size_type			__enqueue;
+	char				__pad0[detail::__cache_line - sizeof(size_type)];
+	size_type			__dequeue;
+	char				__pad1[detail::__cache_line - sizeof(size_type)];
+	__slot_type			*__slots;
+	size_type			__capacity;
+	size_type			__mask;
+	__slot_allocator	__alloc;
+};
+
+} // namespace ft
+
+#endif // FT_CONCURRENT_QUEUE_HPP
@@ -0,0 +1,359 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   concurrent_stack.hpp                               :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 23:08:14 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 23:08:14 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_CONCURRENT_STACK_HPP
+# define FT_CONCURRENT_STACK_HPP
+
+# include <new>
+# include <cstddef>
+# include <stdexcept>
+# include <stdint.h>
+# include <pthread.h>
+# include "utility.hpp"
+# include "thread_pool.hpp"
+
+// Lock-free stack (Treiber): push and try_pop are one compare-and-swap on
+// the head. The head holds a node index and a tag that every successful
+// swap increments, so a head that was popped and pushed back in between
+// (ABA) does not compare equal any more.
+// Nodes come from a pool owned by the stack, itself a lock-free stack of
+// free nodes: once the pool is warm (or reserve()d) push and try_pop never
+// allocate. Nodes are only given back to the system by the destructor,
+// which is what makes reading a node that was popped in the meantime safe.
+// When a swap fails because of contention, the thread goes to the
+// elimination array: a push and a try_pop meeting on the same slot
+// exchange the element there and never touch the head.
+
+namespace ft
+{
+
+namespace detail
+{
+	// 32 bit node index and 32 bit tag in one word, swapped as a whole
+	typedef uint64_t	__tagged_index;
+
+	static const uint32_t	__nil_index = 0xffffffff;
+
+	inline uint32_t	__index_of( __tagged_index word )
+	{ return static_cast<uint32_t>(word); }
+
+	inline __tagged_index	__retag( __tagged_index old, uint32_t index )
+	{ return ((old >> 32) + 1) << 32 | index; }
+
+	// xorshift, one state per thread: picks elimination slots
+	inline uint32_t	__thread_random()
+	{
+		static __thread uint32_t	state = 0;
+		if (state == 0)
+			state = static_cast<uint32_t>(reinterpret_cast<std::size_t>(&state)) | 1;
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+}
+
+template <class T>
+class concurrent_stack
+{
+public:
+	typedef T				value_type;
+	typedef std::size_t		size_type;
+
+	// exchange slots tried when the head is contended, and how long a push
+	// waits in one for a try_pop
+	static const size_type	elimination_slots = 8;
+	static const size_type	elimination_spins = 64;
+
+	explicit concurrent_stack( size_type reserved = 0 ) :
+		__head(detail::__nil_index), __free(detail::__nil_index), __used(0)
+	{
+		for (size_type i = 0; i != __max_blocks; ++i)
+			__blocks[i] = NULL;
+		for (size_type i = 0; i != elimination_slots; ++i)
+			__slots[i].word = detail::__nil_index;
+		pthread_mutex_init(&__grow_mutex, NULL);
+		try
+		{
+			reserve(reserved);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	// not thread safe
+	~concurrent_stack()
+	{
+		uint32_t	i = detail::__index_of(__head);
+		while (i != detail::__nil_index)
+		{
+			__value(i)->~T();
+			i = __node(i)->next;
+		}
+		__release();
+	}
+
+	void	push( const T & value )
+	{
+		uint32_t	i = __new_node();
+		try
+		{
+			::new (static_cast<void *>(__value(i))) T(value);
+		}
+		catch (...)
+		{
+			__push_free(i);
+			throw ;
+		}
+		__push_node(i);
+	}
+
+# if FT_CXX11
+	void	push( T && value )
+	{ emplace(std::move(value)); }
+
+	template <class... Args>
+	void	emplace( Args&&... args )
+	{
+		uint32_t	i = __new_node();
+		try
+		{
+			::new (static_cast<void *>(__value(i))) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			__push_free(i);
+			throw ;
+		}
+		__push_node(i);
+	}
+# endif
+
+	// moves the top element to out, false if the stack was empty
+	bool	try_pop( T & out )
+	{
+		uint32_t	i;
+		bool		empty;
+		for (;;)
+		{
+			if (__try_pop(__head, i, empty))
+				break ;
+			if (empty)
+				return false;
+			if (__eliminate_pop(i))
+				break ;
+		}
+		try
+		{
+			out = FT_MOVE(*__value(i));
+		}
+		catch (...)
+		{
+			__push_node(i);
+			throw ;
+		}
+		__value(i)->~T();
+		__push_free(i);
+		return true;
+	}
+
+	// only a snapshot when other threads are pushing or popping
+	bool	empty() const
+	{
+		return detail::__index_of(__atomic_load_n(&__head, __ATOMIC_ACQUIRE))
+				== detail::__nil_index;
+	}
+
+	// makes sure that n nodes exist, so n elements can be pushed without
+	// allocating
+	void	reserve( size_type n )
+	{
+		if (n > __max_nodes)
+			throw std::length_error("concurrent_stack");
+		detail::__mutex_guard	lock(__grow_mutex);
+		for (size_type k = 0; k != __max_blocks and __block_start(k) < n; ++k)
+			if (__blocks[k] == NULL)
+				__allocate_block(k);
+	}
+
+private:
+	struct __node_type
+	{
+		uint32_t				next;
+		aligned_buffer<sizeof(T), alignment_of<T>::value>	value;
+	};
+
+	// keeps each exchange slot on its own cache line
+	struct __slot_type
+	{
+		detail::__tagged_index	word;
+		char					pad[detail::__cache_line - sizeof(detail::__tagged_index)];
+	};
+
+	// block k holds __first_block << k nodes, so the index space grows
+	// geometrically and no block ever moves
+	static const size_type	__first_block = 64;
+	static const size_type	__max_blocks = 26;
+	static const size_type	__max_nodes = __first_block * ((size_type(1) << __max_blocks) - 1);
+
+	concurrent_stack( const concurrent_stack & );
+	concurrent_stack &	operator=( const concurrent_stack & );
+
+	static size_type	__block_start( size_type k )
+	{ return __first_block * ((size_type(1) << k) - 1); }
+
+	static size_type	__block_of( uint32_t i )
+	{ return 31 - __builtin_clz(static_cast<uint32_t>(i / __first_block + 1)); }
+
+	__node_type *	__node( uint32_t i ) const
+	{
+		size_type	k = __block_of(i);
+		return __atomic_load_n(&__blocks[k], __ATOMIC_ACQUIRE) + (i - __block_start(k));
+	}
+
+	T *	__value( uint32_t i ) const
+	{ return reinterpret_cast<T *>(__node(i)->value.data); }
+
+	// called with __grow_mutex held
+	void	__allocate_block( size_type k )
+	{
+		__node_type	*block = static_cast<__node_type *>(
+							::operator new(sizeof(__node_type) * (__first_block << k)));
+		__atomic_store_n(&__blocks[k], block, __ATOMIC_RELEASE);
+	}
+
+	// a free node, else a never used index (its block allocated if needed)
+	uint32_t	__new_node()
+	{
+		uint32_t	i;
+		bool		empty;
+		while (not __try_pop(__free, i, empty))
+			if (empty)
+				break ;
+		if (not empty)
+			return i;
+		size_type	n = __atomic_fetch_add(&__used, 1, __ATOMIC_RELAXED);
+		if (n >= __max_nodes)
+		{
+			__atomic_fetch_sub(&__used, 1, __ATOMIC_RELAXED);
+			throw std::length_error("concurrent_stack");
+		}
+		size_type	k = __block_of(static_cast<uint32_t>(n));
+		if (__atomic_load_n(&__blocks[k], __ATOMIC_ACQUIRE) == NULL)
+		{
+			detail::__mutex_guard	lock(__grow_mutex);
+			if (__blocks[k] == NULL)
+				__allocate_block(k);
+		}
+		return static_cast<uint32_t>(n);
+	}
+
+	void	__release()
+	{
+		for (size_type k = 0; k != __max_blocks; ++k)
+			::operator delete(__blocks[k]);
+		pthread_mutex_destroy(&__grow_mutex);
+	}
+
+	// one attempt each: false when another thread won the swap
+	bool	__try_push( detail::__tagged_index & list, uint32_t i )
+	{
+		detail::__tagged_index	old = __atomic_load_n(&list, __ATOMIC_RELAXED);
+		__atomic_store_n(&__node(i)->next, detail::__index_of(old), __ATOMIC_RELAXED);
+		return __atomic_compare_exchange_n(&list, &old, detail::__retag(old, i), false,
+											__ATOMIC_RELEASE, __ATOMIC_RELAXED);
+	}
+
+	bool	__try_pop( detail::__tagged_index & list, uint32_t & i, bool & empty )
+	{
+		detail::__tagged_index	old = __atomic_load_n(&list, __ATOMIC_ACQUIRE);
+		i = detail::__index_of(old);
+		empty = i == detail::__nil_index;
+		if (empty)
+			return false;
+		// the node may be popped and reused meanwhile: next is then stale,
+		// but the tag has changed too and the swap fails
+		uint32_t	next = __atomic_load_n(&__node(i)->next, __ATOMIC_RELAXED);
+		return __atomic_compare_exchange_n(&list, &old, detail::__retag(old, next), false,
+											__ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+	}
+
+	void	__push_free( uint32_t i )
+	{
+		while (not __try_push(__free, i))
+			detail::__cpu_relax();
+	}
+
+	void	__push_node( uint32_t i )
+	{
+		while (not __try_push(__head, i) and not __eliminate_push(i))
+			;
+	}
+
+	// offers node i in a random slot for a while; true if a try_pop took it
+	bool	__eliminate_push( uint32_t i )
+	{
+		__slot_type				&slot = __slots[detail::__thread_random() % elimination_slots];
+		detail::__tagged_index	old = __atomic_load_n(&slot.word, __ATOMIC_RELAXED);
+		if (detail::__index_of(old) != detail::__nil_index)
+			return false;
+		detail::__tagged_index	offer = detail::__retag(old, i);
+		if (not __atomic_compare_exchange_n(&slot.word, &old, offer, false,
+											__ATOMIC_RELEASE, __ATOMIC_RELAXED))
+			return false;
+		for (size_type spin = 0; spin != elimination_spins; ++spin)
+		{
+			if (__atomic_load_n(&slot.word, __ATOMIC_RELAXED) != offer)
+				return true;
+			detail::__cpu_relax();
+		}
+		// withdraw the offer, unless it was taken in the meantime
+		return not __atomic_compare_exchange_n(&slot.word, &offer,
+						detail::__retag(offer, detail::__nil_index), false,
+						__ATOMIC_RELAXED, __ATOMIC_RELAXED);
+	}
+
+	// takes the node a push offers in a random slot, if any
+	bool	__eliminate_pop( uint32_t & i )
+	{
+		__slot_type				&slot = __slots[detail::__thread_random() % elimination_slots];
+		detail::__tagged_index	old = __atomic_load_n(&slot.word, __ATOMIC_ACQUIRE);
+		i = detail::__index_of(old);
+		if (i == detail::__nil_index)
+			return false;
+		return __atomic_compare_exchange_n(&slot.word, &old,
+						detail::__retag(old, detail::__nil_index), false,
+						__ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+	}
+
+private:
+	detail::__tagged_index	__head;
+	char					__pad0[detail::__cache_line - sizeof(detail::__tagged_index)];
+	detail::__tagged_index	__free;
+	char					__pad1[detail::__cache_line - sizeof(detail::__tagged_index)];
+	size_type				__used;
+	__node_type				*__blocks[__max_blocks];
+	pthread_mutex_t			__grow_mutex;
+	__slot_type				__slots[elimination_slots];
+};
+
+template <class T>
+const typename concurrent_stack<T>::size_type	concurrent_stack<T>::elimination_slots;
+template <class T>
+const typename concurrent_stack<T>::size_type	concurrent_stack<T>::elimination_spins;
+
+} // namespace ft
+
+#endif // FT_CONCURRENT_STACK_HPP
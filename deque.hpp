@@ -0,0 +1,760 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   deque.hpp                                          :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:03:18 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 22:03:18 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_DEQUE_HPP
+# define FT_DEQUE_HPP
+
+# include <memory>
+# include <algorithm>
+# include <cstddef>
+# include <cstring>
+# include <stdexcept>
+# include "utility.hpp"
+
+namespace ft
+{
+
+namespace detail
+{
+	template <std::size_t N>
+	struct __floor_pow2
+	{ static const std::size_t	value = 2 * __floor_pow2<N / 2>::value; };
+
+	template <>
+	struct __floor_pow2<1>
+	{ static const std::size_t	value = 1; };
+
+	// elements per deque block: a power of two filling about 4 KiB, 16 at
+	// least for big elements
+	template <std::size_t Size>
+	struct __deque_block_size
+	{
+		static const std::size_t	value = __floor_pow2<
+			(Size < 256 ? 4096 / Size : 16)>::value;
+	};
+}
+
+// Random access iterator over the blocks of a deque: the block map and
+// the position counted from its first slot.
+// deque_iterator<T, B> converts to deque_iterator<const T, B>.
+template <class T, std::size_t BlockSize>
+class deque_iterator :
+	public ft::iterator<std::random_access_iterator_tag,
+						typename remove_const<T>::type, std::ptrdiff_t, T*, T&>
+{
+private:
+	typedef typename remove_const<T>::type	__value_type;
+
+	__value_type * const	*__map;
+	std::size_t				__pos;
+public:
+	typedef std::ptrdiff_t	difference_type;
+
+	deque_iterator() : __map(NULL), __pos(0) {}
+	deque_iterator(__value_type * const * map, std::size_t pos) : __map(map), __pos(pos) {}
+	deque_iterator(const deque_iterator<__value_type, BlockSize> & other) :
+		__map(other.__block_map()), __pos(other.__position()) {}
+
+	__value_type * const *	__block_map() const {
+		return __map;
+	}
+	std::size_t	__position() const {
+		return __pos;
+	}
+	T &	operator*() const {
+		return __map[__pos / BlockSize][__pos % BlockSize];
+	}
+	T *	operator->() const {
+		return &**this;
+	}
+	T &	operator[](difference_type n) const {
+		return *(*this + n);
+	}
+	deque_iterator &	operator++() {
+		++__pos;
+		return *this;
+	}
+	deque_iterator		operator++(int) {
+		deque_iterator tmp(*this);
+		++__pos;
+		return tmp;
+	}
+	deque_iterator &	operator--() {
+		--__pos;
+		return *this;
+	}
+	deque_iterator		operator--(int) {
+		deque_iterator tmp(*this);
+		--__pos;
+		return tmp;
+	}
+	deque_iterator &	operator+=(difference_type n) {
+		__pos += n;
+		return *this;
+	}
+	deque_iterator &	operator-=(difference_type n) {
+		__pos -= n;
+		return *this;
+	}
+	deque_iterator		operator+(difference_type n) const {
+		return deque_iterator(__map, __pos + n);
+	}
+	deque_iterator		operator-(difference_type n) const {
+		return deque_iterator(__map, __pos - n);
+	}
+
+	friend deque_iterator	operator+(difference_type n, deque_iterator it)
+	{ return it + n; }
+	friend difference_type	operator-(deque_iterator lhs, deque_iterator rhs)
+	{ return lhs.__pos - rhs.__pos; }
+	friend bool operator==(deque_iterator lhs, deque_iterator rhs)
+	{ return lhs.__pos == rhs.__pos; }
+	friend bool operator!=(deque_iterator lhs, deque_iterator rhs)
+	{ return lhs.__pos != rhs.__pos; }
+	friend bool operator<(deque_iterator lhs, deque_iterator rhs)
+	{ return lhs.__pos < rhs.__pos; }
+	friend bool operator>(deque_iterator lhs, deque_iterator rhs)
+	{ return lhs.__pos > rhs.__pos; }
+	friend bool operator<=(deque_iterator lhs, deque_iterator rhs)
+	{ return lhs.__pos <= rhs.__pos; }
+	friend bool operator>=(deque_iterator lhs, deque_iterator rhs)
+	{ return lhs.__pos >= rhs.__pos; }
+};
+
+// Double-ended queue made of fixed-size blocks reached through a map of
+// block pointers. Elements never move once constructed: growing at either
+// end allocates at most one block, and the map of pointers is recentered
+// or doubled when it runs out of slots. push and pop at both ends are
+// O(1) (the map growth copies one pointer per block, never an element),
+// which makes it a stack container without reallocation spikes.
+// Iterators are invalidated by every insertion, references to the
+// elements only by insert() and erase() in the middle.
+template< class T, class Allocator = std::allocator<T> >
+class deque
+{
+public:
+	typedef T									value_type;
+	typedef Allocator							allocator_type;
+	typedef std::size_t							size_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef value_type&							reference;
+	typedef const value_type&					const_reference;
+	typedef typename Allocator::pointer			pointer;
+	typedef typename Allocator::const_pointer	const_pointer;
+
+	static const size_type	block_size = detail::__deque_block_size<sizeof(T)>::value;
+
+	typedef deque_iterator<T, block_size>				iterator;
+	typedef deque_iterator<const T, block_size>			const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	deque() :
+		__map(NULL), __map_size(0), __block_begin(0), __block_end(0),
+		__start(0), __size(0), __alloc()
+	{}
+
+	explicit deque( const Allocator& alloc ) :
+		__map(NULL), __map_size(0), __block_begin(0), __block_end(0),
+		__start(0), __size(0), __alloc(alloc)
+	{}
+
+	explicit deque( size_type count, const T& value = T(),
+					const Allocator& alloc = Allocator() ) :
+		__map(NULL), __map_size(0), __block_begin(0), __block_end(0),
+		__start(0), __size(0), __alloc(alloc)
+	{
+		try
+		{
+			__append(count, value);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	template< class InputIt >
+	deque( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+			InputIt last, const Allocator& alloc = Allocator() ) :
+		__map(NULL), __map_size(0), __block_begin(0), __block_end(0),
+		__start(0), __size(0), __alloc(alloc)
+	{
+		try
+		{
+			for (; first != last; ++first)
+				push_back(*first);
+		}
+		catch (...)
+		{
+			clear();
+			__release();
+			throw ;
+		}
+	}
+
+	deque( const deque& other ) :
+		__map(NULL), __map_size(0), __block_begin(0), __block_end(0),
+		__start(0), __size(0), __alloc(other.__alloc)
+	{
+		try
+		{
+			for (const_iterator it = other.begin(); it != other.end(); ++it)
+				push_back(*it);
+		}
+		catch (...)
+		{
+			clear();
+			__release();
+			throw ;
+		}
+	}
+
+	~deque()
+	{
+		clear();
+		__release();
+	}
+
+	deque& operator=( const deque& other )
+	{
+		if (this != &other)
+			assign(other.begin(), other.end());
+		return *this;
+	}
+
+# if FT_CXX11
+	deque( deque&& other ) noexcept :
+		__map(NULL), __map_size(0), __block_begin(0), __block_end(0),
+		__start(0), __size(0), __alloc(other.__alloc)
+	{
+		__steal(other);
+	}
+
+	deque& operator=( deque&& other )
+	{
+		if (this == &other)
+			return *this;
+		clear();
+		if (__alloc == other.__alloc)
+		{
+			__release();
+			__steal(other);
+		}
+		else
+		{
+			// the blocks can't change owner, move the elements
+			for (iterator it = other.begin(); it != other.end(); ++it)
+				push_back(std::move(*it));
+			other.clear();
+		}
+		return *this;
+	}
+# endif
+
+	void assign( size_type count, const T& value )
+	{
+		// value can be an element of *this
+		T	tmp(value);
+		clear();
+		__append(count, tmp);
+	}
+
+	template< class InputIt >
+	void assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{
+		size_type	kept = 0;
+		for (; first != last and kept != __size; ++first, ++kept)
+			(*this)[kept] = *first;
+		while (__size > kept)
+			pop_back();
+		for (; first != last; ++first)
+			push_back(*first);
+	}
+
+	allocator_type get_allocator() const
+	{ return __alloc; }
+
+	reference at( size_type pos )
+	{
+		if (pos >= __size)
+			throw std::out_of_range("deque");
+		return (*this)[pos];
+	}
+
+	const_reference at( size_type pos ) const
+	{
+		if (pos >= __size)
+			throw std::out_of_range("deque");
+		return (*this)[pos];
+	}
+
+	reference operator[]( size_type pos )
+	{ return *__slot(__start + pos); }
+
+	const_reference operator[]( size_type pos ) const
+	{ return *__slot(__start + pos); }
+
+	reference front()
+	{ return *__slot(__start); }
+
+	const_reference front() const
+	{ return *__slot(__start); }
+
+	reference back()
+	{ return *__slot(__start + __size - 1); }
+
+	const_reference back() const
+	{ return *__slot(__start + __size - 1); }
+
+	iterator begin()
+	{ return iterator(__map, __start); }
+
+	const_iterator begin() const
+	{ return const_iterator(__map, __start); }
+
+	iterator end()
+	{ return iterator(__map, __start + __size); }
+
+	const_iterator end() const
+	{ return const_iterator(__map, __start + __size); }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{ return __alloc.max_size(); }
+
+	// frees the spare blocks kept around the ends
+	void shrink_to_fit()
+	{
+		while (__block_end > __needed_end())
+			__alloc.deallocate(__map[--__block_end], block_size);
+		while (__block_begin < __needed_begin())
+			__alloc.deallocate(__map[__block_begin++], block_size);
+	}
+
+	void clear()
+	{
+		__destroy(__start, __start + __size);
+		for (size_type b = __block_begin; b != __block_end; ++b)
+			__alloc.deallocate(__map[b], block_size);
+		__block_begin = __map_size / 2;
+		__block_end = __block_begin;
+		__start = __block_begin * block_size;
+		__size = 0;
+	}
+
+	void push_back( const T& value )
+	{
+		__reserve_back();
+		::new (static_cast<void *>(__slot(__start + __size))) T(value);
+		++__size;
+	}
+
+	void push_front( const T& value )
+	{
+		__reserve_front();
+		::new (static_cast<void *>(__slot(__start - 1))) T(value);
+		--__start;
+		++__size;
+	}
+
+# if FT_CXX11
+	void push_back( T&& value )
+	{ emplace_back(std::move(value)); }
+
+	void push_front( T&& value )
+	{ emplace_front(std::move(value)); }
+
+	template< class... Args >
+	void emplace_back( Args&&... args )
+	{
+		__reserve_back();
+		::new (static_cast<void *>(__slot(__start + __size))) T(std::forward<Args>(args)...);
+		++__size;
+	}
+
+	template< class... Args >
+	void emplace_front( Args&&... args )
+	{
+		__reserve_front();
+		::new (static_cast<void *>(__slot(__start - 1))) T(std::forward<Args>(args)...);
+		--__start;
+		++__size;
+	}
+# endif
+
+	void pop_back()
+	{
+		--__size;
+		__slot(__start + __size)->~T();
+		if (__block_end > __needed_end() + 1)
+			__alloc.deallocate(__map[--__block_end], block_size);
+	}
+
+	void pop_front()
+	{
+		__slot(__start)->~T();
+		++__start;
+		--__size;
+		if (__block_begin + 1 < __needed_begin())
+			__alloc.deallocate(__map[__block_begin++], block_size);
+	}
+
+	void resize( size_type count, T value = T() )
+	{
+		while (__size > count)
+			pop_back();
+		__append(count - __size, value);
+	}
+
+	// the allocators are not exchanged, they must compare equal
+	void swap( deque& other )
+	{
+		ft::swap(__map, other.__map);
+		ft::swap(__map_size, other.__map_size);
+		ft::swap(__block_begin, other.__block_begin);
+		ft::swap(__block_end, other.__block_end);
+		ft::swap(__start, other.__start);
+		ft::swap(__size, other.__size);
+	}
+
+	// insertions and erasures in the middle move the elements on the
+	// shorter side of pos; basic exception guarantee
+	iterator insert( iterator pos, const T& value )
+	{
+		size_type	n = pos - begin();
+		insert(pos, 1, value);
+		return begin() + n;
+	}
+
+	void insert( iterator pos, size_type count, const T& value )
+	{
+		size_type	n = pos - begin();
+		T			tmp(value);
+		if (n < __size / 2)
+		{
+			size_type	pushed = 0;
+			try
+			{
+				for (; pushed != count; ++pushed)
+					push_front(tmp);
+			}
+			catch (...)
+			{
+				for (; pushed != 0; --pushed)
+					pop_front();
+				throw ;
+			}
+			std::rotate(begin(), begin() + count, begin() + count + n);
+		}
+		else
+		{
+			size_type	old_size = __size;
+			__append(count, tmp);
+			std::rotate(begin() + n, begin() + old_size, end());
+		}
+	}
+
+	template< class InputIt >
+	void insert( iterator pos, typename enable_if<is_iterator<InputIt>::value,
+					InputIt>::type first, InputIt last )
+	{
+		size_type	n = pos - begin();
+		size_type	old_size = __size;
+		if (n < __size / 2)
+		{
+			try
+			{
+				for (; first != last; ++first)
+					push_front(*first);
+			}
+			catch (...)
+			{
+				while (__size > old_size)
+					pop_front();
+				throw ;
+			}
+			size_type	count = __size - old_size;
+			std::reverse(begin(), begin() + count);
+			std::rotate(begin(), begin() + count, begin() + count + n);
+		}
+		else
+		{
+			try
+			{
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			catch (...)
+			{
+				while (__size > old_size)
+					pop_back();
+				throw ;
+			}
+			std::rotate(begin() + n, begin() + old_size, end());
+		}
+	}
+
+# if FT_CXX11
+	iterator insert( iterator pos, T&& value )
+	{ return emplace(pos, std::move(value)); }
+
+	template< class... Args >
+	iterator emplace( iterator pos, Args&&... args )
+	{
+		size_type	n = pos - begin();
+		if (n < __size / 2)
+		{
+			emplace_front(std::forward<Args>(args)...);
+			std::rotate(begin(), begin() + 1, begin() + 1 + n);
+		}
+		else
+		{
+			emplace_back(std::forward<Args>(args)...);
+			std::rotate(begin() + n, end() - 1, end());
+		}
+		return begin() + n;
+	}
+# endif
+
+	iterator erase( iterator pos )
+	{ return erase(pos, pos + 1); }
+
+	iterator erase( iterator first, iterator last )
+	{
+		size_type	n = first - begin();
+		size_type	count = last - first;
+		if (count == 0)
+			return begin() + n;
+		if (n < __size - n - count)
+		{
+			for (size_type i = n; i-- > 0; )
+				(*this)[i + count] = FT_MOVE((*this)[i]);
+			for (size_type i = 0; i != count; ++i)
+				pop_front();
+		}
+		else
+		{
+			for (size_type i = n + count; i != __size; ++i)
+				(*this)[i - count] = FT_MOVE((*this)[i]);
+			for (size_type i = 0; i != count; ++i)
+				pop_back();
+		}
+		return begin() + n;
+	}
+
+private:
+	typedef typename Allocator::template rebind<T *>::other	__map_allocator;
+
+	T *			__slot( size_type pos ) const
+	{ return __map[pos / block_size] + pos % block_size; }
+
+	// blocks that hold elements: one spare block may stay allocated on
+	// each side, so that a push and a pop alternating across a block
+	// boundary do not allocate every time
+	size_type	__needed_begin() const
+	{ return __start / block_size; }
+
+	size_type	__needed_end() const
+	{ return (__start + __size + block_size - 1) / block_size; }
+
+	void		__destroy( size_type first, size_type last )
+	{
+		if (is_trivially_destructible<T>::value)
+			return ;
+		for (; first != last; ++first)
+			__slot(first)->~T();
+	}
+
+	// makes sure the slot after the last element is allocated
+	void		__reserve_back()
+	{
+		if ((__start + __size) / block_size < __block_end)
+			return ;
+		if (__block_end == __map_size)
+			__recenter();
+		__map[__block_end] = __alloc.allocate(block_size);
+		++__block_end;
+	}
+
+	// makes sure the slot before the first element is allocated
+	void		__reserve_front()
+	{
+		if (__start > __block_begin * block_size)
+			return ;
+		if (__block_begin == 0)
+			__recenter();
+		__map[__block_begin - 1] = __alloc.allocate(block_size);
+		--__block_begin;
+	}
+
+	// moves the block pointers to the middle of the map, in a map twice
+	// as big when more than half of it is in use; only pointers are copied
+	void		__recenter()
+	{
+		size_type	used = __block_end - __block_begin;
+		size_type	offset;
+		if ((used + 2) * 2 <= __map_size)
+		{
+			offset = (__map_size - used) / 2;
+			std::memmove(__map + offset, __map + __block_begin, used * sizeof(T *));
+		}
+		else
+		{
+			__map_allocator	map_alloc(__alloc);
+			size_type		new_size = ft::max((used + 2) * 2, (size_type)8);
+			T				**map = map_alloc.allocate(new_size);
+			offset = (new_size - used) / 2;
+			if (used != 0)
+				std::memcpy(map + offset, __map + __block_begin, used * sizeof(T *));
+			if (__map != NULL)
+				map_alloc.deallocate(__map, __map_size);
+			__map = map;
+			__map_size = new_size;
+		}
+		__start = __start - __block_begin * block_size + offset * block_size;
+		__block_begin = offset;
+		__block_end = offset + used;
+	}
+
+	// count copies of value at the back, all or none
+	void		__append( size_type count, const T& value )
+	{
+		size_type	pushed = 0;
+		try
+		{
+			for (; pushed != count; ++pushed)
+				push_back(value);
+		}
+		catch (...)
+		{
+			for (; pushed != 0; --pushed)
+				pop_back();
+			throw ;
+		}
+	}
+
+	// the deque is empty
+	void		__release()
+	{
+		for (size_type b = __block_begin; b != __block_end; ++b)
+			__alloc.deallocate(__map[b], block_size);
+		if (__map != NULL)
+			__map_allocator(__alloc).deallocate(__map, __map_size);
+		__map = NULL;
+		__map_size = 0;
+		__block_begin = 0;
+		__block_end = 0;
+		__start = 0;
+	}
+
+# if FT_CXX11
+	// *this is empty and owns no storage
+	void		__steal( deque& other )
+	{
+		__map = other.__map;
+		__map_size = other.__map_size;
+		__block_begin = other.__block_begin;
+		__block_end = other.__block_end;
+		__start = other.__start;
+		__size = other.__size;
+		other.__map = NULL;
+		other.__map_size = 0;
+		other.__block_begin = 0;
+		other.__block_end = 0;
+		other.__start = 0;
+		other.__size = 0;
+	}
+# endif
+
+private:
+	T			**__map;
+	size_type	__map_size;
+	size_type	__block_begin;
+	size_type	__block_end;
+	size_type	__start;
+	size_type	__size;
+	Allocator	__alloc;
+};
+
+template< class T, class Allocator >
+const typename deque<T, Allocator>::size_type	deque<T, Allocator>::block_size;
+
+template< class T, class Allocator >
+bool	operator==( const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs )
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template< class T, class Allocator >
+bool	operator!=( const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs )
+{
+	return !(lhs == rhs);
+}
+
+template< class T, class Allocator >
+bool	operator<( const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs )
+{
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template< class T, class Allocator >
+bool	operator<=( const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs )
+{
+	return !(rhs < lhs);
+}
+
+template< class T, class Allocator >
+bool	operator>( const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs )
+{
+	return rhs < lhs;
+}
+
+template< class T, class Allocator >
+bool	operator>=( const deque<T, Allocator>& lhs, const deque<T, Allocator>& rhs )
+{
+	return !(lhs < rhs);
+}
+
+} // namespace ft
+
+namespace std
+{
+	template< class T, class Allocator >
+	void	swap( ft::deque<T, Allocator> & lhs, ft::deque<T, Allocator> & rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // FT_DEQUE_HPP
@@ -0,0 +1,862 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   devector.hpp                                       :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 02:31:44 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 02:31:44 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_DEVECTOR_HPP
+# define FT_DEVECTOR_HPP
+
+# include <memory>
+# include <cstddef>
+# include <cstring>
+# include <stdexcept>
+# include "utility.hpp"
+
+namespace ft
+{
+
+// Vector with free capacity at both ends of its buffer: push_front and
+// push_back are both amortized O(1), and the elements stay contiguous, so
+// data() is a plain array like ft::vector's.
+// When the end that grows is full, the elements are recentered: in place
+// while at least half of the buffer is free, in a buffer twice as big
+// otherwise, with the free slots split evenly between both ends.
+// Inserting or erasing in the middle moves the elements on the side of
+// pos that is shorter.
+template< class T, class Allocator = std::allocator<T> >
+class devector
+{
+public:
+	typedef T									value_type;
+	typedef Allocator							allocator_type;
+	typedef std::size_t							size_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef value_type&							reference;
+	typedef const value_type&					const_reference;
+	typedef typename Allocator::pointer			pointer;
+	typedef typename Allocator::const_pointer	const_pointer;
+
+	typedef contiguous_iterator<T>						iterator;
+	typedef contiguous_iterator<const T>				const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	devector() :
+		__storage(NULL), __front(0), __size(0), __capacity(0), __alloc()
+	{}
+
+	explicit devector( const Allocator& alloc ) :
+		__storage(NULL), __front(0), __size(0), __capacity(0), __alloc(alloc)
+	{}
+
+	explicit devector( size_type count, const T& value = T(),
+					const Allocator& alloc = Allocator() ) :
+		__storage(NULL), __front(0), __size(0), __capacity(0), __alloc(alloc)
+	{
+		assign(count, value);
+	}
+
+	template< class InputIt >
+	devector( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+			InputIt last, const Allocator& alloc = Allocator() ) :
+		__storage(NULL), __front(0), __size(0), __capacity(0), __alloc(alloc)
+	{
+		try
+		{
+			assign(first, last);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	devector( const devector& other ) :
+		__storage(NULL), __front(0), __size(0), __capacity(0), __alloc(other.__alloc)
+	{
+		try
+		{
+			assign(other.data(), other.data() + other.__size);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	~devector()
+	{
+		clear();
+		__release();
+	}
+
+	devector& operator=( const devector& other )
+	{
+		if (this != &other)
+			assign(other.data(), other.data() + other.__size);
+		return *this;
+	}
+
+# if FT_CXX11
+	devector( devector&& other ) noexcept :
+		__storage(other.__storage), __front(other.__front), __size(other.__size),
+		__capacity(other.__capacity), __alloc(other.__alloc)
+	{
+		other.__storage = NULL;
+		other.__front = 0;
+		other.__size = 0;
+		other.__capacity = 0;
+	}
+
+	devector& operator=( devector&& other )
+	{
+		if (this != &other)
+		{
+			clear();
+			if (!(__alloc == other.__alloc))
+			{
+				// the block can't change owner, move the elements
+				if (other.__size > __capacity)
+					__reset_storage(other.__size);
+				__front = (__capacity - other.__size) / 2;
+				detail::__relocate(other.data(), other.data() + other.__size, data());
+				__size = other.__size;
+				other.__size = 0;
+				return *this;
+			}
+			__release();
+			__storage = other.__storage;
+			__front = other.__front;
+			__size = other.__size;
+			__capacity = other.__capacity;
+			other.__storage = NULL;
+			other.__front = 0;
+			other.__size = 0;
+			other.__capacity = 0;
+		}
+		return *this;
+	}
+# endif
+
+	void assign( size_type count, const T& value )
+	{
+		// value can be an element of *this
+		T	tmp(value);
+		clear();
+		if (count > __capacity)
+			__reset_storage(count);
+		__front = (__capacity - count) / 2;
+		detail::__uninitialized_fill(data(), count, tmp);
+		__size = count;
+	}
+
+	template< class InputIt >
+	void assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{
+		size_type	count = ft::distance(first, last);
+		clear();
+		if (count > __capacity)
+			__reset_storage(count);
+		__front = (__capacity - count) / 2;
+		detail::__uninitialized_copy(first, last, data());
+		__size = count;
+	}
+
+	allocator_type get_allocator() const
+	{ return __alloc; }
+
+	reference at( size_type pos )
+	{
+		if (pos >= __size)
+			throw std::out_of_range("devector");
+		return data()[pos];
+	}
+
+	const_reference at( size_type pos ) const
+	{
+		if (pos >= __size)
+			throw std::out_of_range("devector");
+		return data()[pos];
+	}
+
+	reference operator[]( size_type pos )
+	{ return data()[pos]; }
+
+	const_reference operator[]( size_type pos ) const
+	{ return data()[pos]; }
+
+	reference front()
+	{ return data()[0]; }
+
+	const_reference front() const
+	{ return data()[0]; }
+
+	reference back()
+	{ return data()[__size - 1]; }
+
+	const_reference back() const
+	{ return data()[__size - 1]; }
+
+	T* data()
+	{ return __storage + __front; }
+
+	const T* data() const
+	{ return __storage + __front; }
+
+	iterator begin()
+	{ return iterator(data()); }
+
+	const_iterator begin() const
+	{ return const_iterator(data()); }
+
+	iterator end()
+	{ return iterator(data() + __size); }
+
+	const_iterator end() const
+	{ return const_iterator(data() + __size); }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{ return __alloc.max_size(); }
+
+	size_type capacity() const
+	{ return __capacity; }
+
+	// push_front calls before the next reallocation or recentering
+	size_type front_free_capacity() const
+	{ return __front; }
+
+	// push_back calls before the next reallocation or recentering
+	size_type back_free_capacity() const
+	{ return __capacity - __front - __size; }
+
+	// room for new_cap elements without moving the front
+	void reserve( size_type new_cap )
+	{ reserve_back(new_cap); }
+
+	// size() + back_free_capacity() becomes at least new_cap
+	void reserve_back( size_type new_cap )
+	{
+		// strong exception guarantee
+		if (new_cap <= __capacity - __front)
+			return ;
+		if (new_cap > max_size() - __front)
+			throw std::length_error("devector");
+		__adopt(__alloc.allocate(__front + new_cap), __front + new_cap, __front, __size, 0);
+	}
+
+	// size() + front_free_capacity() becomes at least new_cap
+	void reserve_front( size_type new_cap )
+	{
+		// strong exception guarantee
+		if (new_cap <= __front + __size)
+			return ;
+		size_type	back = back_free_capacity();
+		if (new_cap > max_size() - back)
+			throw std::length_error("devector");
+		__adopt(__alloc.allocate(new_cap + back), new_cap + back, new_cap - __size,
+				__size, 0);
+	}
+
+	void shrink_to_fit()
+	{
+		if (__size == __capacity)
+			return ;
+		if (__size == 0)
+		{
+			__release();
+			__storage = NULL;
+			__front = 0;
+			__capacity = 0;
+			return ;
+		}
+		__adopt(__alloc.allocate(__size), __size, 0, __size, 0);
+	}
+
+	// the free slots are split between both ends again
+	void clear()
+	{
+		detail::__destroy(data(), data() + __size);
+		__size = 0;
+		__front = __capacity / 2;
+	}
+
+	void push_back( const T& value )
+	{ insert(end(), 1, value); }
+
+	void push_front( const T& value )
+	{ insert(begin(), 1, value); }
+
+# if FT_CXX11
+	void push_back( T&& value )
+	{ emplace(end(), std::move(value)); }
+
+	void push_front( T&& value )
+	{ emplace(begin(), std::move(value)); }
+
+	template< class... Args >
+	void emplace_back( Args&&... args )
+	{ emplace(end(), std::forward<Args>(args)...); }
+
+	template< class... Args >
+	void emplace_front( Args&&... args )
+	{ emplace(begin(), std::forward<Args>(args)...); }
+# endif
+
+	void pop_back()
+	{
+		--__size;
+		detail::__destroy(data() + __size, data() + __size + 1);
+	}
+
+	void pop_front()
+	{
+		detail::__destroy(data(), data() + 1);
+		++__front;
+		--__size;
+	}
+
+	void resize( size_type count, T value = T() )
+	{
+		if (count < __size)
+		{
+			detail::__destroy(data() + count, data() + __size);
+			__size = count;
+			return ;
+		}
+		insert(end(), count - __size, value);
+	}
+
+	// the allocators are not exchanged, they must compare equal
+	void swap( devector& other )
+	{
+		ft::swap(__storage, other.__storage);
+		ft::swap(__front, other.__front);
+		ft::swap(__size, other.__size);
+		ft::swap(__capacity, other.__capacity);
+	}
+
+	iterator insert( iterator pos, const T& value )
+	{
+		size_type	n = pos - begin();
+		insert(pos, 1, value);
+		return iterator(data() + n);
+	}
+
+	void insert( iterator pos, size_type count, const T& value )
+	{
+		size_type	n = pos - begin();
+		if (count == 0)
+			return ;
+		if (__fits(n, count))
+		{
+			T	*gap = __direct_gap(n, count);
+			if (gap != NULL)
+			{
+				detail::__uninitialized_fill(gap, count, value);
+				__grown(gap, count);
+				return ;
+			}
+			// basic exception guarantee
+			T	tmp(value);
+			__open_gap(n, count);
+			try
+			{
+				detail::__uninitialized_fill(data() + n, count, tmp);
+			}
+			catch (...)
+			{
+				__drop_around(n, count);
+				throw ;
+			}
+		}
+		else
+		{
+			size_type	new_cap, new_front;
+			__plan(count, new_cap, new_front);
+			if (__recenters(new_cap))
+			{
+				// value can be an element, find it again after the move
+				const T		*src = &value;
+				if (src >= data() and src < data() + __size)
+					src = __storage + new_front + (src - data())
+						+ (src - data() >= difference_type(n) ? count : 0);
+				__rearrange(new_front, n, count);
+				try
+				{
+					detail::__uninitialized_fill(data() + n, count, *src);
+				}
+				catch (...)
+				{
+					__close_gap(n, count);
+					throw ;
+				}
+			}
+			else
+			{
+				// strong exception guarantee
+				T	*tmp = __alloc.allocate(new_cap);
+				try
+				{
+					detail::__uninitialized_fill(tmp + new_front + n, count, value);
+				}
+				catch (...)
+				{
+					__alloc.deallocate(tmp, new_cap);
+					throw ;
+				}
+				__adopt(tmp, new_cap, new_front, n, count);
+			}
+		}
+		__size += count;
+	}
+
+	template< class InputIt >
+	void insert( iterator pos, typename enable_if<is_iterator<InputIt>::value,
+					InputIt>::type first, InputIt last )
+	{
+		size_type	n = pos - begin();
+		size_type	count = ft::distance(first, last);
+		if (count == 0)
+			return ;
+		if (__fits(n, count))
+		{
+			T	*gap = __direct_gap(n, count);
+			if (gap != NULL)
+			{
+				detail::__uninitialized_copy(first, last, gap);
+				__grown(gap, count);
+				return ;
+			}
+			// basic exception guarantee
+			__open_gap(n, count);
+			try
+			{
+				detail::__uninitialized_copy(first, last, data() + n);
+			}
+			catch (...)
+			{
+				__drop_around(n, count);
+				throw ;
+			}
+		}
+		else
+		{
+			size_type	new_cap, new_front;
+			__plan(count, new_cap, new_front);
+			if (__recenters(new_cap))
+			{
+				__rearrange(new_front, n, count);
+				try
+				{
+					detail::__uninitialized_copy(first, last, data() + n);
+				}
+				catch (...)
+				{
+					__close_gap(n, count);
+					throw ;
+				}
+			}
+			else
+			{
+				// strong exception guarantee
+				T	*tmp = __alloc.allocate(new_cap);
+				try
+				{
+					detail::__uninitialized_copy(first, last, tmp + new_front + n);
+				}
+				catch (...)
+				{
+					__alloc.deallocate(tmp, new_cap);
+					throw ;
+				}
+				__adopt(tmp, new_cap, new_front, n, count);
+			}
+		}
+		__size += count;
+	}
+
+# if FT_CXX11
+	iterator insert( iterator pos, T&& value )
+	{ return emplace(pos, std::move(value)); }
+
+	template< class... Args >
+	iterator emplace( iterator pos, Args&&... args )
+	{
+		size_type	n = pos - begin();
+		if (__fits(n, 1))
+		{
+			T	*gap = __direct_gap(n, 1);
+			if (gap != NULL)
+			{
+				::new (static_cast<void *>(gap)) T(std::forward<Args>(args)...);
+				__grown(gap, 1);
+				return iterator(data() + n);
+			}
+			// basic exception guarantee
+			T	tmp(std::forward<Args>(args)...);
+			__open_gap(n, 1);
+			try
+			{
+				::new (static_cast<void *>(data() + n)) T(std::move(tmp));
+			}
+			catch (...)
+			{
+				__drop_around(n, 1);
+				throw ;
+			}
+		}
+		else
+		{
+			size_type	new_cap, new_front;
+			__plan(1, new_cap, new_front);
+			if (__recenters(new_cap))
+			{
+				// the arguments may refer to elements
+				T	tmp(std::forward<Args>(args)...);
+				__rearrange(new_front, n, 1);
+				try
+				{
+					::new (static_cast<void *>(data() + n)) T(std::move(tmp));
+				}
+				catch (...)
+				{
+					__close_gap(n, 1);
+					throw ;
+				}
+				++__size;
+				return iterator(data() + n);
+			}
+			// strong exception guarantee, the arguments may refer to elements
+			T			*tmp = __alloc.allocate(new_cap);
+			try
+			{
+				::new (static_cast<void *>(tmp + new_front + n))
+					T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				__alloc.deallocate(tmp, new_cap);
+				throw ;
+			}
+			__adopt(tmp, new_cap, new_front, n, 1);
+		}
+		++__size;
+		return iterator(data() + n);
+	}
+# endif
+
+	iterator erase( iterator pos )
+	{ return erase(pos, pos + 1); }
+
+	iterator erase( iterator first, iterator last )
+	{
+		// basic exception guarantee
+		size_type	n = first - begin();
+		size_type	count = last - first;
+		if (count == 0)
+			return last;
+		T	*p = data();
+		detail::__destroy(p + n, p + n + count);
+		if (n < __size - n - count)
+		{
+			// the head is shorter, it moves up over the hole
+			try
+			{
+				detail::__shift(p, p + n, p + count);
+			}
+			catch (...)
+			{
+				detail::__destroy(p + n + count, p + __size);
+				__size = 0;
+				throw ;
+			}
+			__front += count;
+		}
+		else
+		{
+			try
+			{
+				detail::__shift(p + n + count, p + __size, p + n);
+			}
+			catch (...)
+			{
+				detail::__destroy(p, p + n);
+				__size = 0;
+				throw ;
+			}
+		}
+		__size -= count;
+		return iterator(data() + n);
+	}
+
+private:
+	void		__release()
+	{
+		if (__storage != NULL)
+			__alloc.deallocate(__storage, __capacity);
+	}
+
+	size_type	__recommend( size_type new_size ) const
+	{
+		if (new_size > max_size())
+			throw std::length_error("devector");
+		if (__capacity >= max_size() / 2)
+			return max_size();
+		return ft::max(__capacity * 2, new_size);
+	}
+
+	// storage and front for count more elements when an end is full: the
+	// same buffer while at least half of it stays free, so recentering is
+	// amortized over the pushes it makes room for, a bigger one otherwise
+	void		__plan( size_type count, size_type & new_cap, size_type & new_front ) const
+	{
+		if (count > max_size() - __size)
+			throw std::length_error("devector");
+		size_type	new_size = __size + count;
+		new_cap = new_size <= __capacity / 2 ? __capacity : __recommend(new_size);
+		new_front = (new_cap - new_size) / 2;
+	}
+
+	// trivially relocatable elements are recentered in place with memmove
+	bool		__recenters( size_type new_cap ) const
+	{ return new_cap == __capacity and is_trivially_relocatable<T>::value; }
+
+	// count elements can go at n without reallocating or recentering
+	bool		__fits( size_type n, size_type count ) const
+	{
+		bool	front = __front >= count;
+		bool	back = back_free_capacity() >= count;
+		if (n == 0 and n == __size)
+			return front or back;
+		if (n == 0)
+			return front;
+		if (n == __size)
+			return back;
+		return front or back;
+	}
+
+	// the free slots right before or after the elements when that is where
+	// the new ones go, NULL when some elements have to move
+	T *			__direct_gap( size_type n, size_type count )
+	{
+		if (n == 0 and __front >= count)
+			return data() - count;
+		if (n == __size)
+			return data() + __size;
+		return NULL;
+	}
+
+	// count elements were built in the gap from __direct_gap
+	void		__grown( T * gap, size_type count )
+	{
+		if (gap < data())
+			__front -= count;
+		__size += count;
+	}
+
+	// replaces the (empty) storage with a block of new_cap elements
+	void		__reset_storage( size_type new_cap )
+	{
+		T	*tmp = __alloc.allocate(new_cap);
+		__release();
+		__storage = tmp;
+		__capacity = new_cap;
+	}
+
+	// moves the elements into new_storage around the already constructed
+	// new_storage[new_front + pos, new_front + pos + gap) and makes it the
+	// storage
+	void		__adopt( T * new_storage, size_type new_cap, size_type new_front,
+						size_type pos, size_type gap )
+	{
+		// strong exception guarantee
+		T	*old = data();
+		T	*dest = new_storage + new_front;
+		if (is_trivially_relocatable<T>::value)
+		{
+			detail::__relocate(old, old + pos, dest);
+			detail::__relocate(old + pos, old + __size, dest + pos + gap);
+		}
+		else
+		{
+			bool	head_done = false;
+			try
+			{
+				detail::__uninitialized_move(old, old + pos, dest);
+				head_done = true;
+				detail::__uninitialized_move(old + pos, old + __size, dest + pos + gap);
+			}
+			catch (...)
+			{
+				if (head_done)
+					detail::__destroy(dest, dest + pos);
+				detail::__destroy(dest + pos, dest + pos + gap);
+				__alloc.deallocate(new_storage, new_cap);
+				throw ;
+			}
+			detail::__destroy(old, old + __size);
+		}
+		__release();
+		__storage = new_storage;
+		__front = new_front;
+		__capacity = new_cap;
+	}
+
+	// recenters trivially relocatable elements in place, leaving count
+	// free slots at pos; the head moves first when it goes down, so
+	// neither part runs over the other
+	void		__rearrange( size_type new_front, size_type pos, size_type count )
+	{
+		T	*old = data();
+		T	*dest = __storage + new_front;
+		if (new_front < __front)
+		{
+			detail::__shift(old, old + pos, dest);
+			detail::__shift(old + pos, old + __size, dest + pos + count);
+		}
+		else
+		{
+			detail::__shift(old + pos, old + __size, dest + pos + count);
+			detail::__shift(old, old + pos, dest);
+		}
+		__front = new_front;
+	}
+
+	// filling the gap from __rearrange failed, the tail closes it again
+	void		__close_gap( size_type pos, size_type count )
+	{
+		T	*p = data();
+		detail::__shift(p + pos + count, p + __size + count, p + pos);
+	}
+
+	// opens an unconstructed gap of count slots at pos by moving the
+	// shorter side that has room; the new elements go to data() + pos
+	void		__open_gap( size_type pos, size_type count )
+	{
+		T		*p = data();
+		bool	down = __front >= count
+						and (pos < __size - pos or back_free_capacity() < count);
+		if (down)
+		{
+			try
+			{
+				detail::__shift(p, p + pos, p - count);
+			}
+			catch (...)
+			{
+				detail::__destroy(p + pos, p + __size);
+				__size = 0;
+				throw ;
+			}
+			__front -= count;
+			return ;
+		}
+		try
+		{
+			detail::__shift(p + pos, p + __size, p + pos + count);
+		}
+		catch (...)
+		{
+			detail::__destroy(p, p + pos);
+			__size = 0;
+			throw ;
+		}
+	}
+
+	// filling the gap failed, nothing is left in a usable order
+	void		__drop_around( size_type pos, size_type count )
+	{
+		T	*p = data();
+		detail::__destroy(p, p + pos);
+		detail::__destroy(p + pos + count, p + __size + count);
+		__size = 0;
+	}
+
+private:
+	T			*__storage;
+	// free slots before the first element
+	size_type	__front;
+	size_type	__size;
+	size_type	__capacity;
+	Allocator	__alloc;
+};
+
+template< class T, class Allocator >
+bool	operator==( const devector<T, Allocator>& lhs, const devector<T, Allocator>& rhs )
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template< class T, class Allocator >
+bool	operator!=( const devector<T, Allocator>& lhs, const devector<T, Allocator>& rhs )
+{
+	return !(lhs == rhs);
+}
+
+template< class T, class Allocator >
+bool	operator<( const devector<T, Allocator>& lhs, const devector<T, Allocator>& rhs )
+{
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template< class T, class Allocator >
+bool	operator<=( const devector<T, Allocator>& lhs, const devector<T, Allocator>& rhs )
+{
+	return !(rhs < lhs);
+}
+
+template< class T, class Allocator >
+bool	operator>( const devector<T, Allocator>& lhs, const devector<T, Allocator>& rhs )
+{
+	return rhs < lhs;
+}
+
+template< class T, class Allocator >
+bool	operator>=( const devector<T, Allocator>& lhs, const devector<T, Allocator>& rhs )
+{
+	return !(lhs < rhs);
+}
+
+} // namespace ft
+
+
+namespace std
+{
+	template< class T, class Allocator >
+	void	swap( ft::devector<T, Allocator>& lhs, ft::devector<T, Allocator>& rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // FT_DEVECTOR_HPP
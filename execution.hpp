@@ -0,0 +1,633 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   execution.hpp                                      :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:12:40 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 21:12:40 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_EXECUTION_HPP
+# define FT_EXECUTION_HPP
+
+# include <new>
+# include <cstddef>
+# include <cstring>
+# include "utility.hpp"
+# include "algorithm.hpp"
+# include "thread_pool.hpp"
+
+// Parallel algorithms, chosen by passing ft::par as the first argument:
+//
+//	ft::sort(ft::par, v.begin(), v.end());
+//	ft::fill(ft::par.grain(1 << 16).on(pool), v.begin(), v.end(), 0);
+//
+// The range (random access) is cut in halves until the pieces are no
+// bigger than the grain, and the halves are spread over the pool by work
+// stealing. Without an explicit grain, a range is cut in about eight
+// pieces per worker. The calling thread runs pieces too while it waits.
+// Exceptions thrown by the element functions reach the caller once every
+// piece is done; the range is then left in a valid but unspecified state.
+
+namespace ft
+{
+
+class parallel_policy
+{
+public:
+	parallel_policy() : __grain(0), __pool(0) {}
+
+	// pieces of at most n elements, 0 lets the algorithm choose
+	parallel_policy	grain( std::size_t n ) const
+	{
+		parallel_policy	policy(*this);
+		policy.__grain = n;
+		return policy;
+	}
+
+	// runs on pool instead of thread_pool::global()
+	parallel_policy	on( thread_pool & pool ) const
+	{
+		parallel_policy	policy(*this);
+		policy.__pool = &pool;
+		return policy;
+	}
+
+	std::size_t		grain() const
+	{ return __grain; }
+
+	thread_pool &	pool() const
+	{ return __pool ? *__pool : thread_pool::global(); }
+
+private:
+	std::size_t		__grain;
+	thread_pool		*__pool;
+};
+
+static const parallel_policy	par;
+
+namespace detail
+{
+	static const std::size_t	__min_grain = 2048;
+
+	inline std::size_t	__grain_for( const parallel_policy & policy, std::size_t n )
+	{
+		if (policy.grain() != 0)
+			return policy.grain();
+		std::size_t	grain = n / (policy.pool().size() * 8);
+		return grain < __min_grain ? __min_grain : grain;
+	}
+
+	// runs body(b, e) on the pieces of [begin, end): spawns the upper half
+	// until the rest fits in a grain, then does the rest
+	template <class Body>
+	struct __range_task
+	{
+		task_group	*group;
+		std::size_t	begin;
+		std::size_t	end;
+		std::size_t	grain;
+		Body		body;
+
+		__range_task( task_group * group, std::size_t begin, std::size_t end,
+					std::size_t grain, const Body & body ) :
+			group(group), begin(begin), end(end), grain(grain), body(body)
+		{}
+
+		void	operator()()
+		{
+			std::size_t	e = end;
+			while (e - begin > grain)
+			{
+				std::size_t	mid = begin + (e - begin) / 2;
+				group->run(__range_task(group, mid, e, grain, body));
+				e = mid;
+			}
+			body(begin, e);
+		}
+	};
+
+	template <class Body>
+	void	__parallel_for( thread_pool & pool, std::size_t n, std::size_t grain,
+							const Body & body )
+	{
+		if (grain == 0)
+			grain = 1;
+		if (n <= grain)
+		{
+			Body	b(body);
+			b(0, n);
+			return ;
+		}
+		task_group	group(pool);
+		__range_task<Body>(&group, 0, n, grain, body)();
+		group.wait();
+	}
+
+	template <class It, class F>
+	struct __for_each_body
+	{
+		It	first;
+		F	f;
+
+		__for_each_body( It first, const F & f ) : first(first), f(f) {}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			for (It it = first + b, last = first + e; it != last; ++it)
+				f(*it);
+		}
+	};
+
+	template <class It, class T>
+	struct __fill_body
+	{
+		It	first;
+		T	value;
+
+		__fill_body( It first, const T & value ) : first(first), value(value) {}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			for (It it = first + b, last = first + e; it != last; ++it)
+				*it = value;
+		}
+	};
+
+	template <class It, class Out, class Op>
+	struct __transform_body
+	{
+		It	first;
+		Out	out;
+		Op	op;
+
+		__transform_body( It first, Out out, const Op & op ) :
+			first(first), out(out), op(op)
+		{}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			Out	o = out + b;
+			for (It it = first + b, last = first + e; it != last; ++it, ++o)
+				*o = op(*it);
+		}
+	};
+
+	template <class It1, class It2, class Out, class Op>
+	struct __transform2_body
+	{
+		It1	first1;
+		It2	first2;
+		Out	out;
+		Op	op;
+
+		__transform2_body( It1 first1, It2 first2, Out out, const Op & op ) :
+			first1(first1), first2(first2), out(out), op(op)
+		{}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			It2	it2 = first2 + b;
+			Out	o = out + b;
+			for (It1 it = first1 + b, last = first1 + e; it != last; ++it, ++it2, ++o)
+				*o = op(*it, *it2);
+		}
+	};
+
+	// plain copies between contiguous ranges of the same trivially
+	// copyable type are memcpy
+	template <class It, class Out>
+	struct __copy_is_memcpy : integral_constant<bool,
+			is_contiguous_iterator<It>::value and is_contiguous_iterator<Out>::value
+			and is_same<typename remove_const<typename iterator_traits<It>::value_type>::type,
+						typename iterator_traits<Out>::value_type>::value
+			and is_trivially_copyable<typename iterator_traits<Out>::value_type>::value>
+	{};
+
+	template <class It, class Out>
+	void	__copy_piece( It first, It last, Out out, true_type )
+	{
+		if (first != last)
+			std::memcpy(detail::__to_address(out), detail::__to_address(first),
+						(last - first) * sizeof(*detail::__to_address(out)));
+	}
+
+	template <class It, class Out>
+	void	__copy_piece( It first, It last, Out out, false_type )
+	{
+		for (; first != last; ++first, ++out)
+			*out = *first;
+	}
+
+	template <class It, class Out>
+	struct __copy_body
+	{
+		It	first;
+		Out	out;
+
+		__copy_body( It first, Out out ) : first(first), out(out) {}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			detail::__copy_piece(first + b, first + e, out + b,
+				integral_constant<bool, __copy_is_memcpy<It, Out>::value>());
+		}
+	};
+
+	template <class It, class Out>
+	struct __move_body
+	{
+		It	first;
+		Out	out;
+
+		__move_body( It first, Out out ) : first(first), out(out) {}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			Out	o = out + b;
+			for (It it = first + b, last = first + e; it != last; ++it, ++o)
+				*o = FT_MOVE(*it);
+		}
+	};
+
+	// piece c of the range is reduced into partial[c]; pieces are taken
+	// by index so that the partial results combine in order
+	template <class It, class T, class Op>
+	struct __reduce_body
+	{
+		It			first;
+		std::size_t	n;
+		std::size_t	grain;
+		Op			op;
+		T			*partial;
+		char		*done;
+
+		__reduce_body( It first, std::size_t n, std::size_t grain, const Op & op,
+					T * partial, char * done ) :
+			first(first), n(n), grain(grain), op(op), partial(partial), done(done)
+		{}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			for (std::size_t c = b; c != e; ++c)
+			{
+				std::size_t	lo = c * grain;
+				std::size_t	hi = ft::min(lo + grain, n);
+				It			it = first + lo;
+				T			acc(*it);
+				for (++it; it != first + hi; ++it)
+					acc = op(acc, *it);
+				::new (static_cast<void *>(partial + c)) T(acc);
+				done[c] = 1;
+			}
+		}
+	};
+
+	struct __plus
+	{
+		template <class T, class U>
+		T	operator()( const T & lhs, const U & rhs ) const
+		{ return lhs + rhs; }
+	};
+
+	// Sorting: the pieces are sorted on their own, then merged pairwise,
+	// round after round, between the range and a buffer of the same size.
+	// Each merge is itself split: the middle of the longer run is looked
+	// up in the other one, which cuts the merge in two independent halves.
+
+	template <class It1, class It2, class Out, class Compare>
+	struct __merge_task
+	{
+		task_group	*group;
+		It1			a;
+		It1			a_end;
+		It2			b;
+		It2			b_end;
+		Out			out;
+		Compare		comp;
+		std::size_t	grain;
+
+		__merge_task( task_group * group, It1 a, It1 a_end, It2 b, It2 b_end, Out out,
+					const Compare & comp, std::size_t grain ) :
+			group(group), a(a), a_end(a_end), b(b), b_end(b_end), out(out),
+			comp(comp), grain(grain)
+		{}
+
+		void	operator()()
+		{
+			while (static_cast<std::size_t>((a_end - a) + (b_end - b)) > grain)
+			{
+				It1	a_mid;
+				It2	b_mid;
+				// equal elements of the first run stay in front
+				if (a_end - a >= b_end - b)
+				{
+					a_mid = a + (a_end - a) / 2;
+					b_mid = ft::lower_bound(b, b_end, *a_mid, comp);
+				}
+				else
+				{
+					b_mid = b + (b_end - b) / 2;
+					a_mid = ft::upper_bound(a, a_end, *b_mid, comp);
+				}
+				group->run(__merge_task(group, a_mid, a_end, b_mid, b_end,
+										out + ((a_mid - a) + (b_mid - b)), comp, grain));
+				a_end = a_mid;
+				b_end = b_mid;
+			}
+			for (; a != a_end and b != b_end; ++out)
+			{
+				if (comp(*b, *a))
+					*out = FT_MOVE(*b++);
+				else
+					*out = FT_MOVE(*a++);
+			}
+			for (; a != a_end; ++a, ++out)
+				*out = FT_MOVE(*a);
+			for (; b != b_end; ++b, ++out)
+				*out = FT_MOVE(*b);
+		}
+	};
+
+	template <class It, class Compare>
+	void	__sort_piece( It first, It last, const Compare & comp )
+	{ ft::sort(first, last, comp); }
+
+	// the default order keeps the radix path of ft::sort
+	template <class It, class T>
+	void	__sort_piece( It first, It last, const __less<T> & )
+	{ ft::sort(first, last); }
+
+	template <class It, class Compare>
+	struct __sort_body
+	{
+		It			first;
+		std::size_t	n;
+		std::size_t	piece;
+		Compare		comp;
+
+		__sort_body( It first, std::size_t n, std::size_t piece, const Compare & comp ) :
+			first(first), n(n), piece(piece), comp(comp)
+		{}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			for (std::size_t c = b; c != e; ++c)
+				detail::__sort_piece(first + c * piece,
+									first + ft::min((c + 1) * piece, n), comp);
+		}
+	};
+
+	// move constructs piece c of the range into buf; a piece that throws
+	// destroys what it built, the finished ones are marked in done
+	template <class It, class T>
+	struct __construct_body
+	{
+		It			first;
+		std::size_t	n;
+		std::size_t	grain;
+		T			*buf;
+		char		*done;
+
+		__construct_body( It first, std::size_t n, std::size_t grain, T * buf, char * done ) :
+			first(first), n(n), grain(grain), buf(buf), done(done)
+		{}
+
+		void	operator()( std::size_t b, std::size_t e )
+		{
+			for (std::size_t c = b; c != e; ++c)
+			{
+				T	*begin = buf + c * grain;
+				T	*end = buf + ft::min((c + 1) * grain, n);
+				T	*cur = begin;
+				try
+				{
+					for (It it = first + c * grain; cur != end; ++it, ++cur)
+						::new (static_cast<void *>(cur)) T(FT_MOVE(*it));
+				}
+				catch (...)
+				{
+					detail::__destroy(begin, cur);
+					throw ;
+				}
+				done[c] = 1;
+			}
+		}
+	};
+
+	// raw buffer for the merges; trivially copyable elements are written
+	// into it directly, others are first moved into it from the range,
+	// which then holds the moved-from objects
+	template <class T>
+	class __sort_buffer
+	{
+	public:
+		explicit __sort_buffer( std::size_t n ) : __storage(n), __size(0) {}
+
+		~__sort_buffer()
+		{ detail::__destroy(get(), get() + __size); }
+
+		T *	get() const
+		{ return __storage.get(); }
+
+		// true when the elements were moved to the buffer
+		template <class It>
+		bool	construct( thread_pool & pool, It first, std::size_t n, std::size_t grain )
+		{
+			if (is_trivially_copyable<T>::value)
+				return false;
+			std::size_t					pieces = (n + grain - 1) / grain;
+			__temporary_buffer<char>	done(pieces);
+			std::memset(done.get(), 0, pieces);
+			try
+			{
+				detail::__parallel_for(pool, pieces, 1,
+					__construct_body<It, T>(first, n, grain, get(), done.get()));
+			}
+			catch (...)
+			{
+				for (std::size_t c = 0; c < pieces; ++c)
+					if (done.get()[c])
+						detail::__destroy(get() + c * grain,
+										get() + ft::min((c + 1) * grain, n));
+				throw ;
+			}
+			__size = n;
+			return true;
+		}
+
+	private:
+		__sort_buffer( const __sort_buffer & );
+		__sort_buffer &	operator=( const __sort_buffer & );
+
+		__temporary_buffer<T>	__storage;
+		std::size_t				__size;
+	};
+
+	template <class Src, class Dst, class Compare>
+	void	__merge_round( thread_pool & pool, Src src, Dst dst, std::size_t n,
+							std::size_t width, const Compare & comp, std::size_t grain )
+	{
+		task_group	group(pool);
+		for (std::size_t lo = 0; lo < n; lo += 2 * width)
+		{
+			std::size_t	mid = ft::min(lo + width, n);
+			std::size_t	hi = ft::min(lo + 2 * width, n);
+			group.run(__merge_task<Src, Src, Dst, Compare>(&group, src + lo, src + mid,
+									src + mid, src + hi, dst + lo, comp, grain));
+		}
+		group.wait();
+	}
+
+	template <class It, class Compare>
+	void	__parallel_sort( const parallel_policy & policy, It first, It last,
+							const Compare & comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+
+		thread_pool	&pool = policy.pool();
+		std::size_t	n = last - first;
+		std::size_t	grain = __grain_for(policy, n);
+		if (n <= grain)
+		{
+			detail::__sort_piece(first, last, comp);
+			return ;
+		}
+		// fewer, bigger pieces than the other algorithms: every doubling
+		// of their number costs one more merge round over the range
+		std::size_t	piece = ft::max(grain, n / (pool.size() * 2));
+		std::size_t	pieces = (n + piece - 1) / piece;
+		detail::__parallel_for(pool, pieces, 1,
+							__sort_body<It, Compare>(first, n, piece, comp));
+		if (pieces == 1)
+			return ;
+		__sort_buffer<T>	buf(n);
+		bool	in_buffer = buf.construct(pool, first, n, grain);
+		for (std::size_t width = piece; width < n; width *= 2)
+		{
+			if (in_buffer)
+				detail::__merge_round(pool, buf.get(), first, n, width, comp, grain);
+			else
+				detail::__merge_round(pool, first, buf.get(), n, width, comp, grain);
+			in_buffer = not in_buffer;
+		}
+		if (in_buffer)
+			detail::__parallel_for(pool, n, grain, __move_body<T *, It>(buf.get(), first));
+	}
+}
+
+template <class RandomIt, class UnaryFunction>
+void	for_each( const parallel_policy & policy, RandomIt first, RandomIt last,
+				UnaryFunction f )
+{
+	std::size_t	n = last - first;
+	detail::__parallel_for(policy.pool(), n, detail::__grain_for(policy, n),
+		detail::__for_each_body<RandomIt, UnaryFunction>(first, f));
+}
+
+template <class RandomIt, class T>
+void	fill( const parallel_policy & policy, RandomIt first, RandomIt last, const T & value )
+{
+	std::size_t	n = last - first;
+	detail::__parallel_for(policy.pool(), n, detail::__grain_for(policy, n),
+		detail::__fill_body<RandomIt, T>(first, value));
+}
+
+template <class RandomIt, class OutputIt, class UnaryOperation>
+OutputIt	transform( const parallel_policy & policy, RandomIt first, RandomIt last,
+						OutputIt d_first, UnaryOperation op )
+{
+	std::size_t	n = last - first;
+	detail::__parallel_for(policy.pool(), n, detail::__grain_for(policy, n),
+		detail::__transform_body<RandomIt, OutputIt, UnaryOperation>(first, d_first, op));
+	return d_first + n;
+}
+
+template <class RandomIt1, class RandomIt2, class OutputIt, class BinaryOperation>
+OutputIt	transform( const parallel_policy & policy, RandomIt1 first1, RandomIt1 last1,
+						RandomIt2 first2, OutputIt d_first, BinaryOperation op )
+{
+	std::size_t	n = last1 - first1;
+	detail::__parallel_for(policy.pool(), n, detail::__grain_for(policy, n),
+		detail::__transform2_body<RandomIt1, RandomIt2, OutputIt, BinaryOperation>(
+			first1, first2, d_first, op));
+	return d_first + n;
+}
+
+template <class RandomIt, class OutputIt>
+OutputIt	copy( const parallel_policy & policy, RandomIt first, RandomIt last,
+					OutputIt d_first )
+{
+	std::size_t	n = last - first;
+	detail::__parallel_for(policy.pool(), n, detail::__grain_for(policy, n),
+		detail::__copy_body<RandomIt, OutputIt>(first, d_first));
+	return d_first + n;
+}
+
+// op must be associative: the pieces are reduced on their own and their
+// results combined from left to right
+template <class RandomIt, class T, class BinaryOperation>
+T		reduce( const parallel_policy & policy, RandomIt first, RandomIt last, T init,
+				BinaryOperation op )
+{
+	std::size_t	n = last - first;
+	if (n == 0)
+		return init;
+	std::size_t	grain = detail::__grain_for(policy, n);
+	std::size_t	pieces = (n + grain - 1) / grain;
+	detail::__temporary_buffer<T>		partial(pieces);
+	detail::__temporary_buffer<char>	done(pieces);
+	std::memset(done.get(), 0, pieces);
+	try
+	{
+		detail::__parallel_for(policy.pool(), pieces, 1,
+			detail::__reduce_body<RandomIt, T, BinaryOperation>(first, n, grain, op,
+															partial.get(), done.get()));
+		for (std::size_t c = 0; c < pieces; ++c)
+			init = op(init, partial.get()[c]);
+	}
+	catch (...)
+	{
+		for (std::size_t c = 0; c < pieces; ++c)
+			if (done.get()[c])
+				partial.get()[c].~T();
+		throw ;
+	}
+	detail::__destroy(partial.get(), partial.get() + pieces);
+	return init;
+}
+
+template <class RandomIt, class T>
+T		reduce( const parallel_policy & policy, RandomIt first, RandomIt last, T init )
+{
+	return ft::reduce(policy, first, last, init, detail::__plus());
+}
+
+template <class RandomIt>
+typename iterator_traits<RandomIt>::value_type
+		reduce( const parallel_policy & policy, RandomIt first, RandomIt last )
+{
+	return ft::reduce(policy, first, last,
+					typename iterator_traits<RandomIt>::value_type(), detail::__plus());
+}
+
+// the pieces are sorted with ft::sort, so equal elements may be reordered
+template <class RandomIt, class Compare>
+void	sort( const parallel_policy & policy, RandomIt first, RandomIt last, Compare comp )
+{
+	detail::__parallel_sort(policy, first, last, comp);
+}
+
+template <class RandomIt>
+void	sort( const parallel_policy & policy, RandomIt first, RandomIt last )
+{
+	detail::__parallel_sort(policy, first, last,
+		detail::__less<typename iterator_traits<RandomIt>::value_type>());
+}
+
+} // namespace ft
+
+#endif // FT_EXECUTION_HPP
@@ -0,0 +1,686 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   hive.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 01:52:06 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 01:52:06 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_HIVE_HPP
+# define FT_HIVE_HPP
+
+# include <memory>
+# include <cstddef>
+# include <stdexcept>
+# include <limits>
+# include <algorithm>
+# include <stdint.h>
+# include "utility.hpp"
+
+// Unordered container whose elements never move (colony / hive).
+// Elements live in groups that double in size up to __max_group slots,
+// linked in a list; insert and erase never move other elements, so
+// pointers and iterators to them stay valid until they are erased.
+// Each group has a skip field with one counter per slot: 0 for an
+// element, and for a run of erased slots the run length at both ends of
+// the run, so iteration jumps over any run of holes in one step
+// ("jump-counting" skip field).
+// The runs of a group are linked through the erased slots themselves,
+// and the groups with runs are linked too: insert reuses the first slot
+// of a run in O(1), otherwise it appends to the last group. A group left
+// empty by erase is freed.
+
+namespace ft
+{
+
+namespace detail
+{
+	typedef uint16_t	__skip_type;
+
+	static const __skip_type	__no_slot = 0xffff;
+
+	// an erased slot holds the links of its run, so it must fit them and
+	// keep them aligned
+	template <class T>
+	struct __hive_stride
+	{
+		static const std::size_t	__size = sizeof(T) > 2 * sizeof(__skip_type)
+											? sizeof(T) : 2 * sizeof(__skip_type);
+		static const std::size_t	__align = alignment_of<T>::value > sizeof(__skip_type)
+											? alignment_of<T>::value : sizeof(__skip_type);
+		static const std::size_t	value = (__size + __align - 1) / __align * __align;
+	};
+
+	struct __hive_group
+	{
+		char			*slots;
+		// capacity + 1 counters, the last one stays 0
+		__skip_type		*skip;
+		__hive_group	*prev;
+		__hive_group	*next;
+		// list of the groups that have runs of erased slots
+		__hive_group	*prev_erased;
+		__hive_group	*next_erased;
+		std::size_t		capacity;
+		// slots below top have been used
+		std::size_t		top;
+		std::size_t		size;
+		// first slot of the first run of erased slots
+		__skip_type		free_run;
+	};
+}
+
+// Bidirectional iterator over a hive: a group and a slot in it.
+// hive_iterator<T> converts to hive_iterator<const T>.
+template <class T>
+class hive_iterator :
+	public ft::iterator<std::bidirectional_iterator_tag,
+						typename remove_const<T>::type, std::ptrdiff_t, T*, T&>
+{
+private:
+	typedef typename remove_const<T>::type	__value_type;
+
+	detail::__hive_group	*__group;
+	std::size_t				__slot;
+public:
+	hive_iterator() : __group(NULL), __slot(0) {}
+	hive_iterator(detail::__hive_group * group, std::size_t slot) :
+		__group(group), __slot(slot) {}
+	hive_iterator(const hive_iterator<__value_type> & other) :
+		__group(other.__get_group()), __slot(other.__get_slot()) {}
+
+	detail::__hive_group *	__get_group() const {
+		return __group;
+	}
+	std::size_t	__get_slot() const {
+		return __slot;
+	}
+	T &	operator*() const {
+		return *reinterpret_cast<T *>(__group->slots
+					+ __slot * detail::__hive_stride<__value_type>::value);
+	}
+	T *	operator->() const {
+		return &**this;
+	}
+	// jumps over the run of erased slots that follows, if any
+	hive_iterator &	operator++() {
+		++__slot;
+		__slot += __group->skip[__slot];
+		if (__slot == __group->top and __group->next != NULL)
+		{
+			__group = __group->next;
+			__slot = __group->skip[0];
+		}
+		return *this;
+	}
+	hive_iterator	operator++(int) {
+		hive_iterator tmp(*this);
+		++*this;
+		return tmp;
+	}
+	// the slot before a run holds its length too
+	hive_iterator &	operator--() {
+		for (;;)
+		{
+			if (__slot == 0)
+			{
+				__group = __group->prev;
+				__slot = __group->top;
+			}
+			--__slot;
+			std::size_t	run = __group->skip[__slot];
+			if (run == 0)
+				return *this;
+			if (run <= __slot)
+			{
+				__slot -= run;
+				return *this;
+			}
+			// the run starts the group
+			__slot = 0;
+		}
+	}
+	hive_iterator	operator--(int) {
+		hive_iterator tmp(*this);
+		--*this;
+		return tmp;
+	}
+
+	friend bool operator==( const hive_iterator & lhs, const hive_iterator & rhs )
+	{ return lhs.__group == rhs.__group and lhs.__slot == rhs.__slot; }
+	friend bool operator!=( const hive_iterator & lhs, const hive_iterator & rhs )
+	{ return not (lhs == rhs); }
+};
+
+template< class T, class Allocator = std::allocator<T> >
+class hive
+{
+public:
+	typedef T									value_type;
+	typedef Allocator							allocator_type;
+	typedef std::size_t							size_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef value_type&							reference;
+	typedef const value_type&					const_reference;
+	typedef typename Allocator::pointer			pointer;
+	typedef typename Allocator::const_pointer	const_pointer;
+
+	typedef hive_iterator<T>							iterator;
+	typedef hive_iterator<const T>						const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	hive() :
+		__first(NULL), __last(NULL), __erased(NULL), __size(0), __capacity(0),
+		__alloc(), __group_alloc()
+	{}
+
+	explicit hive( const Allocator& alloc ) :
+		__first(NULL), __last(NULL), __erased(NULL), __size(0), __capacity(0),
+		__alloc(alloc), __group_alloc(alloc)
+	{}
+
+	hive( size_type count, const T& value, const Allocator& alloc = Allocator() ) :
+		__first(NULL), __last(NULL), __erased(NULL), __size(0), __capacity(0),
+		__alloc(alloc), __group_alloc(alloc)
+	{
+		try
+		{
+			for (; count != 0; --count)
+				insert(value);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	template< class InputIt >
+	hive( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+		InputIt last, const Allocator& alloc = Allocator() ) :
+		__first(NULL), __last(NULL), __erased(NULL), __size(0), __capacity(0),
+		__alloc(alloc), __group_alloc(alloc)
+	{
+		try
+		{
+			for (; first != last; ++first)
+				insert(*first);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	hive( const hive& other ) :
+		__first(NULL), __last(NULL), __erased(NULL), __size(0), __capacity(0),
+		__alloc(other.__alloc), __group_alloc(other.__group_alloc)
+	{
+		try
+		{
+			for (const_iterator it = other.begin(); it != other.end(); ++it)
+				insert(*it);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	~hive()
+	{ __release(); }
+
+	hive& operator=( const hive& other )
+	{
+		if (this != &other)
+		{
+			// the groups come from this->__alloc, not from other's
+			clear();
+			for (const_iterator it = other.begin(); it != other.end(); ++it)
+				insert(*it);
+		}
+		return *this;
+	}
+
+# if FT_CXX11
+	hive( hive&& other ) noexcept :
+		__first(NULL), __last(NULL), __erased(NULL), __size(0), __capacity(0),
+		__alloc(other.__alloc), __group_alloc(other.__group_alloc)
+	{ swap(other); }
+
+	hive& operator=( hive&& other )
+	{
+		if (this != &other)
+		{
+			__release();
+			if (!(__alloc == other.__alloc))
+			{
+				// the groups can't change owner, move the elements
+				for (iterator it = other.begin(); it != other.end(); ++it)
+					emplace(std::move(*it));
+				other.clear();
+				return *this;
+			}
+			swap(other);
+		}
+		return *this;
+	}
+# endif
+
+	allocator_type get_allocator() const
+	{ return __alloc; }
+
+	iterator begin()
+	{ return __first ? iterator(__first, __first->skip[0]) : iterator(); }
+
+	const_iterator begin() const
+	{ return __first ? const_iterator(__first, __first->skip[0]) : const_iterator(); }
+
+	iterator end()
+	{ return __last ? iterator(__last, __last->top) : iterator(); }
+
+	const_iterator end() const
+	{ return __last ? const_iterator(__last, __last->top) : const_iterator(); }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{ return std::numeric_limits<difference_type>::max() / __stride; }
+
+	// slots in the groups, used or not
+	size_type capacity() const
+	{ return __capacity; }
+
+	void clear()
+	{ __release(); }
+
+	// O(1), in an erased slot when there is one
+	iterator insert( const T& value )
+	{
+		detail::__hive_group	*group;
+		std::size_t				slot;
+		detail::__skip_type		next = __find_slot(group, slot);
+		try
+		{
+			::new (static_cast<void *>(__at(group, slot))) T(value);
+		}
+		catch (...)
+		{
+			__restore(group, slot, next);
+			throw ;
+		}
+		__commit(group, slot, next);
+		return iterator(group, slot);
+	}
+
+# if FT_CXX11
+	iterator insert( T&& value )
+	{ return emplace(std::move(value)); }
+
+	template< class... Args >
+	iterator emplace( Args&&... args )
+	{
+		detail::__hive_group	*group;
+		std::size_t				slot;
+		detail::__skip_type		next = __find_slot(group, slot);
+		try
+		{
+			::new (static_cast<void *>(__at(group, slot))) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			__restore(group, slot, next);
+			throw ;
+		}
+		__commit(group, slot, next);
+		return iterator(group, slot);
+	}
+# endif
+
+	// O(1), returns the iterator to the next element
+	iterator erase( const_iterator pos )
+	{
+		detail::__hive_group	*group = pos.__get_group();
+		std::size_t				slot = pos.__get_slot();
+		iterator				next(group, slot);
+		++next;
+		__at(group, slot)->~T();
+		--__size;
+		if (--group->size == 0)
+		{
+			bool	was_last = group == __last;
+			__remove_group(group);
+			return was_last ? end() : next;
+		}
+		__erase_slot(group, slot);
+		return next;
+	}
+
+	iterator erase( const_iterator first, const_iterator last )
+	{
+		// the last group may be freed, end() moves with it
+		if (last == end())
+		{
+			while (first != end())
+				first = erase(first);
+			return end();
+		}
+		while (first != last)
+			first = erase(first);
+		return iterator(last.__get_group(), last.__get_slot());
+	}
+
+	// iterator to the element at p, which must be in the hive; O(groups)
+	iterator get_iterator( const T * p )
+	{
+		const char	*byte = reinterpret_cast<const char *>(p);
+		for (detail::__hive_group * g = __first; g != NULL; g = g->next)
+			if (byte >= g->slots and byte < g->slots + g->capacity * __stride)
+				return iterator(g, (byte - g->slots) / __stride);
+		return end();
+	}
+
+	const_iterator get_iterator( const T * p ) const
+	{ return const_cast<hive *>(this)->get_iterator(p); }
+
+	// the allocators are not exchanged, they must compare equal
+	void swap( hive& other )
+	{
+		ft::swap(__first, other.__first);
+		ft::swap(__last, other.__last);
+		ft::swap(__erased, other.__erased);
+		ft::swap(__size, other.__size);
+		ft::swap(__capacity, other.__capacity);
+	}
+
+private:
+	typedef detail::__hive_group											__group_type;
+	typedef typename Allocator::template rebind<char>::other				__byte_allocator;
+	typedef typename Allocator::template rebind<__group_type>::other		__group_allocator;
+
+	static const std::size_t	__stride = detail::__hive_stride<T>::value;
+	static const std::size_t	__min_group = 8;
+	// run lengths must fit in a __skip_type
+	static const std::size_t	__max_group = 8192;
+
+	static T *	__at( __group_type * group, std::size_t slot )
+	{ return reinterpret_cast<T *>(group->slots + slot * __stride); }
+
+	// [0] previous run, [1] next run of the group, __no_slot for none
+	static detail::__skip_type *	__links( __group_type * group, std::size_t slot )
+	{ return reinterpret_cast<detail::__skip_type *>(group->slots + slot * __stride); }
+
+	// where the next element goes, nothing changes until __commit; returns
+	// the run that follows when the slot starts a run, the element
+	// overwrites its links
+	detail::__skip_type	__find_slot( __group_type *& group, std::size_t & slot )
+	{
+		if (__erased != NULL)
+		{
+			group = __erased;
+			slot = group->free_run;
+			return __links(group, slot)[1];
+		}
+		if (__last == NULL or __last->top == __last->capacity)
+			__add_group();
+		group = __last;
+		slot = group->top;
+		return detail::__no_slot;
+	}
+
+	// the constructor threw after writing over the links of the run
+	static void	__restore( __group_type * group, std::size_t slot,
+							detail::__skip_type next )
+	{
+		__links(group, slot)[0] = detail::__no_slot;
+		__links(group, slot)[1] = next;
+	}
+
+	// the element at slot is constructed: takes the slot out of its run
+	void	__commit( __group_type * group, std::size_t slot, detail::__skip_type next )
+	{
+		++__size;
+		++group->size;
+		if (slot == group->top)
+		{
+			++group->top;
+			return ;
+		}
+		// first slot of the first run
+		detail::__skip_type	*skip = group->skip;
+		std::size_t			run = skip[slot];
+		skip[slot] = 0;
+		if (run == 1)
+		{
+			group->free_run = next;
+			if (next != detail::__no_slot)
+				__links(group, next)[0] = detail::__no_slot;
+			else
+				__unlink_erased(group);
+			return ;
+		}
+		// the run now starts one slot later
+		skip[slot + 1] = run - 1;
+		skip[slot + run - 1] = run - 1;
+		__links(group, slot + 1)[0] = detail::__no_slot;
+		__links(group, slot + 1)[1] = next;
+		if (next != detail::__no_slot)
+			__links(group, next)[0] = slot + 1;
+		group->free_run = slot + 1;
+	}
+
+	void	__erase_slot( __group_type * group, std::size_t slot )
+	{
+		detail::__skip_type	*skip = group->skip;
+		std::size_t			left = slot > 0 ? skip[slot - 1] : 0;
+		std::size_t			right = skip[slot + 1];
+		if (group->free_run == detail::__no_slot)
+			__link_erased(group);
+		if (left == 0 and right == 0)
+		{
+			skip[slot] = 1;
+			__push_run(group, slot);
+		}
+		else if (right == 0)
+		{
+			skip[slot - left] = left + 1;
+			skip[slot] = left + 1;
+		}
+		else if (left == 0)
+		{
+			// the run on the right now starts at slot
+			detail::__skip_type	prev = __links(group, slot + 1)[0];
+			detail::__skip_type	next = __links(group, slot + 1)[1];
+			__links(group, slot)[0] = prev;
+			__links(group, slot)[1] = next;
+			if (prev != detail::__no_slot)
+				__links(group, prev)[1] = slot;
+			else
+				group->free_run = slot;
+			if (next != detail::__no_slot)
+				__links(group, next)[0] = slot;
+			skip[slot] = right + 1;
+			skip[slot + right] = right + 1;
+		}
+		else
+		{
+			// joins both runs, the left one stays in the list
+			__pop_run(group, slot + 1);
+			skip[slot - left] = left + right + 1;
+			skip[slot + right] = left + right + 1;
+			skip[slot] = 1;
+		}
+	}
+
+	void	__push_run( __group_type * group, std::size_t slot )
+	{
+		__links(group, slot)[0] = detail::__no_slot;
+		__links(group, slot)[1] = group->free_run;
+		if (group->free_run != detail::__no_slot)
+			__links(group, group->free_run)[0] = slot;
+		group->free_run = slot;
+	}
+
+	void	__pop_run( __group_type * group, std::size_t slot )
+	{
+		detail::__skip_type	prev = __links(group, slot)[0];
+		detail::__skip_type	next = __links(group, slot)[1];
+		if (prev != detail::__no_slot)
+			__links(group, prev)[1] = next;
+		else
+			group->free_run = next;
+		if (next != detail::__no_slot)
+			__links(group, next)[0] = prev;
+	}
+
+	void	__link_erased( __group_type * group )
+	{
+		group->prev_erased = NULL;
+		group->next_erased = __erased;
+		if (__erased != NULL)
+			__erased->prev_erased = group;
+		__erased = group;
+	}
+
+	void	__unlink_erased( __group_type * group )
+	{
+		if (group->prev_erased != NULL)
+			group->prev_erased->next_erased = group->next_erased;
+		else
+			__erased = group->next_erased;
+		if (group->next_erased != NULL)
+			group->next_erased->prev_erased = group->prev_erased;
+	}
+
+	void	__add_group()
+	{
+		std::size_t	capacity = __last ? ft::min(__last->capacity * 2, __max_group)
+									: __min_group;
+		__byte_allocator	bytes(__alloc);
+		std::size_t			slot_bytes = capacity * __stride;
+		std::size_t			size = slot_bytes + (capacity + 1) * sizeof(detail::__skip_type);
+		char				*block = bytes.allocate(size);
+		__group_type		*group;
+		try
+		{
+			group = __group_alloc.allocate(1);
+		}
+		catch (...)
+		{
+			bytes.deallocate(block, size);
+			throw ;
+		}
+		group->slots = block;
+		group->skip = reinterpret_cast<detail::__skip_type *>(block + slot_bytes);
+		std::fill(group->skip, group->skip + capacity + 1, detail::__skip_type(0));
+		group->prev = __last;
+		group->next = NULL;
+		group->prev_erased = NULL;
+		group->next_erased = NULL;
+		group->capacity = capacity;
+		group->top = 0;
+		group->size = 0;
+		group->free_run = detail::__no_slot;
+		if (__last != NULL)
+			__last->next = group;
+		else
+			__first = group;
+		__last = group;
+		__capacity += capacity;
+	}
+
+	// the group holds no element any more
+	void	__remove_group( __group_type * group )
+	{
+		if (group->free_run != detail::__no_slot)
+			__unlink_erased(group);
+		if (group->prev != NULL)
+			group->prev->next = group->next;
+		else
+			__first = group->next;
+		if (group->next != NULL)
+			group->next->prev = group->prev;
+		else
+			__last = group->prev;
+		__capacity -= group->capacity;
+		__free_group(group);
+	}
+
+	void	__free_group( __group_type * group )
+	{
+		__byte_allocator	bytes(__alloc);
+		bytes.deallocate(group->slots,
+						group->capacity * __stride
+						+ (group->capacity + 1) * sizeof(detail::__skip_type));
+		__group_alloc.deallocate(group, 1);
+	}
+
+	void	__release()
+	{
+		if (not is_trivially_destructible<T>::value)
+			for (iterator it = begin(); it != end(); ++it)
+				(*it).~T();
+		while (__first != NULL)
+		{
+			__group_type	*next = __first->next;
+			__free_group(__first);
+			__first = next;
+		}
+		__last = NULL;
+		__erased = NULL;
+		__size = 0;
+		__capacity = 0;
+	}
+
+private:
+	__group_type		*__first;
+	__group_type		*__last;
+	__group_type		*__erased;
+	size_type			__size;
+	size_type			__capacity;
+	Allocator			__alloc;
+	__group_allocator	__group_alloc;
+};
+
+template< class T, class Allocator >
+const std::size_t	hive<T, Allocator>::__stride;
+template< class T, class Allocator >
+const std::size_t	hive<T, Allocator>::__min_group;
+template< class T, class Allocator >
+const std::size_t	hive<T, Allocator>::__max_group;
+
+} // namespace ft
+
+namespace std
+{
+	template< class T, class Allocator >
+	void	swap( ft::hive<T, Allocator> & lhs, ft::hive<T, Allocator> & rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // FT_HIVE_HPP
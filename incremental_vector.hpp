@@ -0,0 +1,805 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   incremental_vector.hpp                             :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 22:41:56 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 22:41:56 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_INCREMENTAL_VECTOR_HPP
+# define FT_INCREMENTAL_VECTOR_HPP
+
+# include <memory>
+# include <cstddef>
+# include <cstring>
+# include <stdexcept>
+# include "utility.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+
+// Random access iterator that goes through Container::operator[]: the
+// container and an index. Stays valid as long as the index does.
+// indexed_iterator<C, T> converts to indexed_iterator<const C, const T>.
+template <class Container, class T>
+class indexed_iterator :
+	public ft::iterator<std::random_access_iterator_tag,
+						typename remove_const<T>::type, std::ptrdiff_t, T*, T&>
+{
+private:
+	Container	*__container;
+	std::size_t	__pos;
+public:
+	typedef std::ptrdiff_t	difference_type;
+
+	indexed_iterator() : __container(NULL), __pos(0) {}
+	indexed_iterator(Container * container, std::size_t pos) :
+		__container(container), __pos(pos) {}
+	indexed_iterator(const indexed_iterator<typename remove_const<Container>::type,
+					typename remove_const<T>::type> & other) :
+		__container(other.__owner()), __pos(other.__index()) {}
+
+	Container *	__owner() const {
+		return __container;
+	}
+	std::size_t	__index() const {
+		return __pos;
+	}
+	T &	operator*() const {
+		return (*__container)[__pos];
+	}
+	T *	operator->() const {
+		return &(*__container)[__pos];
+	}
+	T &	operator[](difference_type n) const {
+		return (*__container)[__pos + n];
+	}
+	indexed_iterator &	operator++() {
+		++__pos;
+		return *this;
+	}
+	indexed_iterator	operator++(int) {
+		indexed_iterator tmp(*this);
+		++__pos;
+		return tmp;
+	}
+	indexed_iterator &	operator--() {
+		--__pos;
+		return *this;
+	}
+	indexed_iterator	operator--(int) {
+		indexed_iterator tmp(*this);
+		--__pos;
+		return tmp;
+	}
+	indexed_iterator &	operator+=(difference_type n) {
+		__pos += n;
+		return *this;
+	}
+	indexed_iterator &	operator-=(difference_type n) {
+		__pos -= n;
+		return *this;
+	}
+	indexed_iterator	operator+(difference_type n) const {
+		return indexed_iterator(__container, __pos + n);
+	}
+	indexed_iterator	operator-(difference_type n) const {
+		return indexed_iterator(__container, __pos - n);
+	}
+
+	friend indexed_iterator	operator+(difference_type n, indexed_iterator it)
+	{ return it + n; }
+	friend difference_type	operator-(indexed_iterator lhs, indexed_iterator rhs)
+	{ return lhs.__pos - rhs.__pos; }
+	friend bool operator==(indexed_iterator lhs, indexed_iterator rhs)
+	{ return lhs.__pos == rhs.__pos; }
+	friend bool operator!=(indexed_iterator lhs, indexed_iterator rhs)
+	{ return lhs.__pos != rhs.__pos; }
+	friend bool operator<(indexed_iterator lhs, indexed_iterator rhs)
+	{ return lhs.__pos < rhs.__pos; }
+	friend bool operator>(indexed_iterator lhs, indexed_iterator rhs)
+	{ return lhs.__pos > rhs.__pos; }
+	friend bool operator<=(indexed_iterator lhs, indexed_iterator rhs)
+	{ return lhs.__pos <= rhs.__pos; }
+	friend bool operator>=(indexed_iterator lhs, indexed_iterator rhs)
+	{ return lhs.__pos >= rhs.__pos; }
+};
+
+// Vector whose push_back is O(1) in the worst case, not only amortized.
+// When it is full, a buffer twice as big is allocated and the elements
+// are moved there migration_step at a time by the push_backs that
+// follow, the way a hash table resizes incrementally; the move is over
+// long before the new buffer fills up.
+// While elements are moving, [0, migrated) and [old_end, size) are in
+// the new buffer and [migrated, old_end) is still in the old one, so
+// operator[] costs one more comparison. data(), reserve(), shrink_to_fit()
+// and insert() or erase() anywhere but at the end finish the migration
+// first, then work on the one contiguous buffer. The iterators are
+// indices and are not invalidated by push_back.
+template< class T, class Allocator >
+class vector<T, Allocator, growth::incremental>
+{
+public:
+	typedef T									value_type;
+	typedef Allocator							allocator_type;
+	typedef growth::incremental					growth_policy;
+	typedef std::size_t							size_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef value_type&							reference;
+	typedef const value_type&					const_reference;
+	typedef typename Allocator::pointer			pointer;
+	typedef typename Allocator::const_pointer	const_pointer;
+
+	typedef indexed_iterator<vector, T>					iterator;
+	typedef indexed_iterator<const vector, const T>		const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	// elements moved by each push_back during a migration
+	static const size_type	migration_step = 2;
+
+	vector() :
+		__data(NULL), __size(0), __capacity(0), __old(NULL), __old_capacity(0),
+		__migrated(0), __old_end(0), __alloc()
+	{}
+
+	explicit vector( const Allocator& alloc ) :
+		__data(NULL), __size(0), __capacity(0), __old(NULL), __old_capacity(0),
+		__migrated(0), __old_end(0), __alloc(alloc)
+	{}
+
+	explicit vector( size_type count, const T& value = T(),
+					const Allocator& alloc = Allocator() ) :
+		__data(NULL), __size(0), __capacity(0), __old(NULL), __old_capacity(0),
+		__migrated(0), __old_end(0), __alloc(alloc)
+	{
+		try
+		{
+			assign(count, value);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	template< class InputIt >
+	vector( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+			InputIt last, const Allocator& alloc = Allocator() ) :
+		__data(NULL), __size(0), __capacity(0), __old(NULL), __old_capacity(0),
+		__migrated(0), __old_end(0), __alloc(alloc)
+	{
+		try
+		{
+			assign(first, last);
+		}
+		catch (...)
+		{
+			clear();
+			__release();
+			throw ;
+		}
+	}
+
+	vector( const vector& other ) :
+		__data(NULL), __size(0), __capacity(0), __old(NULL), __old_capacity(0),
+		__migrated(0), __old_end(0), __alloc(other.__alloc)
+	{
+		try
+		{
+			assign(other.begin(), other.end());
+		}
+		catch (...)
+		{
+			clear();
+			__release();
+			throw ;
+		}
+	}
+
+	~vector()
+	{
+		clear();
+		__release();
+	}
+
+	vector& operator=( const vector& other )
+	{
+		if (this != &other)
+			assign(other.begin(), other.end());
+		return *this;
+	}
+
+# if FT_CXX11
+	vector( vector&& other ) noexcept :
+		__data(NULL), __size(0), __capacity(0), __old(NULL), __old_capacity(0),
+		__migrated(0), __old_end(0), __alloc(other.__alloc)
+	{
+		__steal(other);
+	}
+
+	vector& operator=( vector&& other )
+	{
+		if (this == &other)
+			return *this;
+		clear();
+		if (__alloc == other.__alloc)
+		{
+			__release();
+			__steal(other);
+		}
+		else
+		{
+			// the buffers can't change owner, move the elements
+			reserve(other.__size);
+			for (size_type i = 0; i != other.__size; ++i)
+				push_back(std::move(other[i]));
+			other.clear();
+		}
+		return *this;
+	}
+# endif
+
+	void assign( size_type count, const T& value )
+	{
+		// value can be an element of *this
+		T	tmp(value);
+		clear();
+		reserve(count);
+		for (; __size != count; ++__size)
+			::new (static_cast<void *>(__data + __size)) T(tmp);
+	}
+
+	template< class InputIt >
+	void assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{
+		size_type	kept = 0;
+		for (; first != last and kept != __size; ++first, ++kept)
+			(*this)[kept] = *first;
+		while (__size > kept)
+			pop_back();
+		for (; first != last; ++first)
+			push_back(*first);
+	}
+
+	allocator_type get_allocator() const
+	{ return __alloc; }
+
+	reference at( size_type pos )
+	{
+		if (pos >= __size)
+			throw std::out_of_range("vector");
+		return *__slot(pos);
+	}
+
+	const_reference at( size_type pos ) const
+	{
+		if (pos >= __size)
+			throw std::out_of_range("vector");
+		return *__slot(pos);
+	}
+
+	reference operator[]( size_type pos )
+	{ return *__slot(pos); }
+
+	const_reference operator[]( size_type pos ) const
+	{ return *__slot(pos); }
+
+	reference front()
+	{ return *__slot(0); }
+
+	const_reference front() const
+	{ return *__slot(0); }
+
+	reference back()
+	{ return *__slot(__size - 1); }
+
+	const_reference back() const
+	{ return *__slot(__size - 1); }
+
+	// O(n) when a migration is running
+	T* data()
+	{
+		__finish_migration();
+		return __data;
+	}
+
+	const T* data() const
+	{
+		__finish_migration();
+		return __data;
+	}
+
+	iterator begin()
+	{ return iterator(this, 0); }
+
+	const_iterator begin() const
+	{ return const_iterator(this, 0); }
+
+	iterator end()
+	{ return iterator(this, __size); }
+
+	const_iterator end() const
+	{ return const_iterator(this, __size); }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{ return __alloc.max_size(); }
+
+	size_type capacity() const
+	{ return __capacity; }
+
+	// finishes the migration, then moves everything at once if new_cap
+	// does not fit
+	void reserve( size_type new_cap )
+	{
+		__finish_migration();
+		if (new_cap <= __capacity)
+			return ;
+		if (new_cap > max_size())
+			throw std::length_error("vector");
+		T	*tmp = __alloc.allocate(new_cap);
+		try
+		{
+			detail::__relocate(__data, __data + __size, tmp);
+		}
+		catch (...)
+		{
+			__alloc.deallocate(tmp, new_cap);
+			throw ;
+		}
+		if (__data != NULL)
+			__alloc.deallocate(__data, __capacity);
+		__data = tmp;
+		__capacity = new_cap;
+	}
+
+	void shrink_to_fit()
+	{
+		__finish_migration();
+		if (__size == __capacity)
+			return ;
+		if (__size == 0)
+		{
+			__release();
+			return ;
+		}
+		T	*tmp = __alloc.allocate(__size);
+		try
+		{
+			detail::__relocate(__data, __data + __size, tmp);
+		}
+		catch (...)
+		{
+			__alloc.deallocate(tmp, __size);
+			throw ;
+		}
+		__alloc.deallocate(__data, __capacity);
+		__data = tmp;
+		__capacity = __size;
+	}
+
+	void clear()
+	{
+		detail::__destroy(__data, __data + __migrated);
+		detail::__destroy(__old + __migrated, __old + __old_end);
+		detail::__destroy(__data + __old_end, __data + __size);
+		__drop_old();
+		__size = 0;
+	}
+
+	void push_back( const T& value )
+	{
+		if (__size == __capacity)
+			__grow();
+		::new (static_cast<void *>(__data + __size)) T(value);
+		++__size;
+		__step();
+	}
+
+# if FT_CXX11
+	void push_back( T&& value )
+	{ emplace_back(std::move(value)); }
+
+	template< class... Args >
+	void emplace_back( Args&&... args )
+	{
+		if (__size == __capacity)
+			__grow();
+		::new (static_cast<void *>(__data + __size)) T(std::forward<Args>(args)...);
+		++__size;
+		__step();
+	}
+# endif
+
+	void pop_back()
+	{
+		--__size;
+		__slot(__size)->~T();
+		if (__size < __old_end)
+		{
+			__old_end = __size;
+			if (__old_end <= __migrated)
+				__drop_old();
+		}
+	}
+
+	void resize( size_type count, T value = T() )
+	{
+		while (__size > count)
+			pop_back();
+		size_type	old_size = __size;
+		try
+		{
+			while (__size < count)
+				push_back(value);
+		}
+		catch (...)
+		{
+			while (__size > old_size)
+				pop_back();
+			throw ;
+		}
+	}
+
+	void resize_default_init( size_type count )
+	{
+		while (__size > count)
+			pop_back();
+		if (count > __capacity)
+			reserve(__recommend(count));
+		// the slots past the old elements are in the new buffer
+		size_type	old_size = __size;
+		try
+		{
+			for (; __size < count; ++__size)
+				::new (static_cast<void *>(__data + __size)) T;
+		}
+		catch (...)
+		{
+			detail::__destroy(__data + old_size, __data + __size);
+			__size = old_size;
+			throw ;
+		}
+	}
+
+	// resize_default_init restricted to trivially default constructible T
+	void resize_uninitialized( size_type count )
+	{
+		// doesn't compile for T that would need a constructor call
+		(void) sizeof(char[is_trivially_default_constructible<T>::value ? 1 : -1]);
+		resize_default_init(count);
+	}
+
+	template< class InputIt >
+	void append( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{ insert(end(), first, last); }
+
+	void append( const T* ptr, size_type n )
+	{ insert(end(), ptr, ptr + n); }
+
+	// the allocators are not exchanged, they must compare equal
+	void swap( vector& other )
+	{
+		ft::swap(__data, other.__data);
+		ft::swap(__size, other.__size);
+		ft::swap(__capacity, other.__capacity);
+		ft::swap(__old, other.__old);
+		ft::swap(__old_capacity, other.__old_capacity);
+		ft::swap(__migrated, other.__migrated);
+		ft::swap(__old_end, other.__old_end);
+	}
+
+	iterator insert( iterator pos, const T& value )
+	{
+		size_type	n = pos - begin();
+		insert(pos, 1, value);
+		return iterator(this, n);
+	}
+
+	void insert( iterator pos, size_type count, const T& value )
+	{
+		size_type	n = pos - begin();
+		if (count == 0)
+			return ;
+		// value can be an element of *this
+		T	tmp(value);
+		__make_room(count);
+		if (n == __size)
+			detail::__uninitialized_fill(__data + n, count, tmp);
+		else
+		{
+			// basic exception guarantee
+			__open_gap(n, count);
+			try
+			{
+				detail::__uninitialized_fill(__data + n, count, tmp);
+			}
+			catch (...)
+			{
+				__drop_around(n, count);
+				throw ;
+			}
+		}
+		__size += count;
+	}
+
+	template< class InputIt >
+	void insert( iterator pos, typename enable_if<is_iterator<InputIt>::value,
+					InputIt>::type first, InputIt last )
+	{
+		size_type	n = pos - begin();
+		size_type	count = ft::distance(first, last);
+		if (count == 0)
+			return ;
+		__make_room(count);
+		if (n == __size)
+			detail::__uninitialized_copy(first, last, __data + n);
+		else
+		{
+			// basic exception guarantee
+			__open_gap(n, count);
+			try
+			{
+				detail::__uninitialized_copy(first, last, __data + n);
+			}
+			catch (...)
+			{
+				__drop_around(n, count);
+				throw ;
+			}
+		}
+		__size += count;
+	}
+
+# if FT_CXX11
+	iterator insert( iterator pos, T&& value )
+	{ return emplace(pos, std::move(value)); }
+
+	// O(1) at end(), like emplace_back
+	template< class... Args >
+	iterator emplace( iterator pos, Args&&... args )
+	{
+		size_type	n = pos - begin();
+		if (n == __size)
+		{
+			emplace_back(std::forward<Args>(args)...);
+			return iterator(this, n);
+		}
+		// basic exception guarantee
+		T	tmp(std::forward<Args>(args)...);
+		__make_room(1);
+		__open_gap(n, 1);
+		try
+		{
+			::new (static_cast<void *>(__data + n)) T(std::move(tmp));
+		}
+		catch (...)
+		{
+			__drop_around(n, 1);
+			throw ;
+		}
+		++__size;
+		return iterator(this, n);
+	}
+# endif
+
+	iterator erase( iterator pos )
+	{ return erase(pos, pos + 1); }
+
+	// erasing a tail is pop_backs and keeps the migration going
+	iterator erase( iterator first, iterator last )
+	{
+		// basic exception guarantee
+		size_type	n = first - begin();
+		size_type	count = last - first;
+		if (count == 0)
+			return last;
+		if (n + count == __size)
+		{
+			while (__size > n)
+				pop_back();
+			return end();
+		}
+		__finish_migration();
+		detail::__destroy(__data + n, __data + n + count);
+		try
+		{
+			detail::__shift(__data + n + count, __data + __size, __data + n);
+		}
+		catch (...)
+		{
+			detail::__destroy(__data, __data + n);
+			__size = 0;
+			throw ;
+		}
+		__size -= count;
+		return iterator(this, n);
+	}
+
+private:
+	T *		__slot( size_type pos ) const
+	{ return (pos >= __migrated and pos < __old_end) ? __old + pos : __data + pos; }
+
+	size_type	__recommend( size_type new_size ) const
+	{
+		if (new_size > max_size())
+			throw std::length_error("vector");
+		size_type	new_cap = growth::incremental::next(__capacity, new_size, sizeof(T));
+		if (new_cap > max_size() or new_cap < new_size)
+			new_cap = max_size();
+		return new_cap;
+	}
+
+	// O(1): the new buffer is only allocated, the elements follow
+	void	__grow()
+	{
+		__finish_migration();
+		if (__size == max_size())
+			throw std::length_error("vector");
+		size_type	new_cap = __recommend(__size + 1);
+		T	*tmp = __alloc.allocate(new_cap);
+		__old = __data;
+		__old_capacity = __capacity;
+		__migrated = 0;
+		__old_end = __size;
+		__data = tmp;
+		__capacity = new_cap;
+		if (__old_end == 0)
+			__drop_old();
+	}
+
+	// migration step of a push_back; the new element is taken back when
+	// it throws
+	void	__step()
+	{
+		if (__old == NULL)
+			return ;
+		try
+		{
+			__migrate(migration_step);
+		}
+		catch (...)
+		{
+			--__size;
+			(__data + __size)->~T();
+			throw ;
+		}
+	}
+
+	// everything in the new buffer, contiguous again; const because the
+	// elements only change place, see the mutable members
+	void	__finish_migration() const
+	{ __migrate(__old_end - __migrated); }
+
+	// capacity for count more elements, in one contiguous buffer
+	void	__make_room( size_type count )
+	{
+		__finish_migration();
+		if (count > max_size() - __size)
+			throw std::length_error("vector");
+		if (__size + count > __capacity)
+			reserve(__recommend(__size + count));
+	}
+
+	// moves [pos, size) up by count, the gap is left unconstructed
+	void	__open_gap( size_type pos, size_type count )
+	{
+		try
+		{
+			detail::__shift(__data + pos, __data + __size, __data + pos + count);
+		}
+		catch (...)
+		{
+			detail::__destroy(__data, __data + pos);
+			__size = 0;
+			throw ;
+		}
+	}
+
+	// filling the gap failed, nothing is left in a usable order
+	void	__drop_around( size_type pos, size_type count )
+	{
+		detail::__destroy(__data, __data + pos);
+		detail::__destroy(__data + pos + count, __data + __size + count);
+		__size = 0;
+	}
+
+	// moves the next count elements of the old buffer, frees it once it
+	// is empty
+	void	__migrate( size_type count ) const
+	{
+		if (__old == NULL)
+			return ;
+		count = ft::min(count, __old_end - __migrated);
+		detail::__relocate(__old + __migrated, __old + __migrated + count,
+							__data + __migrated);
+		__migrated += count;
+		if (__migrated == __old_end)
+			__drop_old();
+	}
+
+	void	__drop_old() const
+	{
+		if (__old != NULL)
+			__alloc.deallocate(__old, __old_capacity);
+		__old = NULL;
+		__old_capacity = 0;
+		__migrated = 0;
+		__old_end = 0;
+	}
+
+	// the vector is empty
+	void	__release()
+	{
+		if (__data != NULL)
+			__alloc.deallocate(__data, __capacity);
+		__data = NULL;
+		__capacity = 0;
+	}
+
+# if FT_CXX11
+	// *this is empty and owns no storage
+	void	__steal( vector& other )
+	{
+		__data = other.__data;
+		__size = other.__size;
+		__capacity = other.__capacity;
+		__old = other.__old;
+		__old_capacity = other.__old_capacity;
+		__migrated = other.__migrated;
+		__old_end = other.__old_end;
+		other.__data = NULL;
+		other.__size = 0;
+		other.__capacity = 0;
+		other.__old = NULL;
+		other.__old_capacity = 0;
+		other.__migrated = 0;
+		other.__old_end = 0;
+	}
+# endif
+
+private:
+	// the migration state is mutable so that data() const can finish it
+	mutable T *			__data;
+	size_type			__size;
+	size_type			__capacity;
+	mutable T *			__old;
+	mutable size_type	__old_capacity;
+	mutable size_type	__migrated;
+	mutable size_type	__old_end;
+	mutable Allocator	__alloc;
+};
+
+template< class T, class Allocator >
+const typename vector<T, Allocator, growth::incremental>::size_type
+	vector<T, Allocator, growth::incremental>::migration_step;
+
+} // namespace ft
+
+#endif // FT_INCREMENTAL_VECTOR_HPP
@@ -23,9 +23,14 @@ namespace ft
 template <class Key, class T, class Compare>
 struct PairCompare
 {
+	Compare	comp;
+
+	PairCompare( const Compare & comp = Compare() ) : comp(comp)
+	{}
+
 	bool	operator()(const ft::pair<const Key, T> & first, const ft::pair<const Key, T> & second) const
 	{
-		return Compare()(first.first, second.first);
+		return comp(first.first, second.first);
 	}
 };
 
@@ -82,7 +87,7 @@ public:
 	template< class InputIt >
 	map( InputIt first, InputIt last,
 		const Compare& comp = Compare(),
-		const Allocator& alloc = Allocator() )
+		const Allocator& alloc = Allocator() ) : __tree(comp, alloc)
 	{
 		for (; first != last; ++first)
 			__tree.insert(*first);
@@ -99,6 +104,17 @@ public:
 		__tree = other.__tree;
 		return *this;
 	}
+
+# if FT_CXX11
+	map( map&& other ) noexcept : __tree(std::move(other.__tree))
+	{}
+
+	map& operator=( map&& other )
+	{
+		__tree = std::move(other.__tree);
+		return *this;
+	}
+# endif
 	
 	allocator_type get_allocator() const
 	{ return __tree.get_allocator(); }
@@ -171,6 +187,22 @@ public:
 	void insert( InputIt first, InputIt last )
 	{ __tree.insert(first, last); }
 
+# if FT_CXX11
+	ft::pair<iterator,bool> insert( value_type&& value )
+	{ return __tree.insert(std::move(value)); }
+
+	iterator insert( iterator hint, value_type&& value )
+	{ return __tree.insert(hint, std::move(value)); }
+
+	template< class... Args >
+	ft::pair<iterator,bool> emplace( Args&&... args )
+	{ return __tree.emplace(std::forward<Args>(args)...); }
+
+	template< class... Args >
+	iterator emplace_hint( iterator hint, Args&&... args )
+	{ return __tree.emplace_hint(hint, std::forward<Args>(args)...); }
+# endif
+
 	void erase( iterator pos )
 	{ __tree.erase(pos); }
 
@@ -0,0 +1,633 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   mmap_vector.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 03:18:27 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 03:18:27 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_MMAP_VECTOR_HPP
+# define FT_MMAP_VECTOR_HPP
+
+# include <cstddef>
+# include <cstring>
+# include <cerrno>
+# include <string>
+# include <stdexcept>
+# include <limits>
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+# include "utility.hpp"
+# include "allocator.hpp"
+
+// Vector of trivially copyable records whose storage is a memory mapping
+// of a file: opening a file of any size is O(1), the kernel pages the
+// records in when they are touched and out again under memory pressure,
+// so the file may be bigger than RAM.
+// The file holds the records back to back and nothing else. While it is
+// open with read_write, it is extended to the capacity (ftruncate, then
+// mremap on Linux) and cut back to size() * sizeof(T) bytes on close.
+// Without a file, the storage is an anonymous mapping.
+
+namespace ft
+{
+
+struct mmap_mode
+{
+	enum type
+	{
+		// changes go to the file (MAP_SHARED)
+		read_write,
+		// PROT_READ, every modifier throws std::logic_error
+		read_only,
+		// changes stay private to the process (MAP_PRIVATE), the file is
+		// never written
+		copy_on_write
+	};
+};
+
+// madvise hints for a range of the records
+struct mmap_advice
+{
+	enum type
+	{
+		normal,
+		sequential,
+		random,
+		will_need,
+		dont_need
+	};
+};
+
+template< class T >
+class mmap_vector
+{
+	typedef char	__requires_trivially_copyable[is_trivially_copyable<T>::value ? 1 : -1];
+public:
+	typedef T									value_type;
+	typedef std::size_t							size_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef value_type&							reference;
+	typedef const value_type&					const_reference;
+	typedef T *									pointer;
+	typedef const T *							const_pointer;
+
+	typedef contiguous_iterator<T>						iterator;
+	typedef contiguous_iterator<const T>				const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	// anonymous storage
+	mmap_vector() :
+		__data(NULL), __size(0), __capacity(0), __mapped(0), __file_bytes(0), __fd(-1),
+		__mode(mmap_mode::read_write), __file_mapped(false)
+	{}
+
+	explicit mmap_vector( const char * path, mmap_mode::type mode = mmap_mode::read_write ) :
+		__data(NULL), __size(0), __capacity(0), __mapped(0), __file_bytes(0), __fd(-1),
+		__mode(mmap_mode::read_write), __file_mapped(false)
+	{
+		open(path, mode);
+	}
+
+	~mmap_vector()
+	{ close(); }
+
+# if FT_CXX11
+	mmap_vector( mmap_vector&& other ) noexcept :
+		__data(NULL), __size(0), __capacity(0), __mapped(0), __file_bytes(0), __fd(-1),
+		__mode(mmap_mode::read_write), __file_mapped(false)
+	{ swap(other); }
+
+	mmap_vector& operator=( mmap_vector&& other )
+	{
+		if (this != &other)
+		{
+			close();
+			swap(other);
+		}
+		return *this;
+	}
+# endif
+
+	// maps the records of path, which read_write creates when it is
+	// missing; the file size must be a multiple of sizeof(T)
+	void open( const char * path, mmap_mode::type mode = mmap_mode::read_write )
+	{
+		close();
+		int	fd = ::open(path, mode == mmap_mode::read_write ? O_RDWR | O_CREAT : O_RDONLY,
+						0644);
+		if (fd < 0)
+			__fail("open");
+		struct stat	st;
+		if (fstat(fd, &st) != 0)
+		{
+			int	err = errno;
+			::close(fd);
+			errno = err;
+			__fail("fstat");
+		}
+		std::size_t	bytes = st.st_size;
+		if (bytes % sizeof(T) != 0)
+		{
+			::close(fd);
+			throw std::runtime_error("mmap_vector: file size is not a multiple of the record size");
+		}
+		__fd = fd;
+		__mode = mode;
+		__file_bytes = bytes;
+		__size = bytes / sizeof(T);
+		if (bytes == 0)
+			return ;
+		void	*p = mmap(NULL, bytes, __protection(), __flags(), __fd, 0);
+		if (p == MAP_FAILED)
+		{
+			int	err = errno;
+			::close(__fd);
+			__fd = -1;
+			__size = 0;
+			errno = err;
+			__fail("mmap");
+		}
+		__data = static_cast<T *>(p);
+		__capacity = __size;
+		__mapped = bytes;
+		__file_mapped = true;
+	}
+
+	// unmaps and closes the file, the vector is empty and anonymous again
+	void close()
+	{
+		if (__data != NULL)
+			munmap(__data, __mapped);
+		if (__fd >= 0)
+		{
+			// nothing to do about a failure here, the file only keeps its
+			// slack past the last record
+			if (__mode == mmap_mode::read_write
+				and ftruncate(__fd, __size * sizeof(T)) != 0)
+			{}
+			::close(__fd);
+		}
+		__data = NULL;
+		__size = 0;
+		__capacity = 0;
+		__mapped = 0;
+		__file_bytes = 0;
+		__fd = -1;
+		__mode = mmap_mode::read_write;
+		__file_mapped = false;
+	}
+
+	bool is_open() const
+	{ return __fd >= 0; }
+
+	mmap_mode::type mode() const
+	{ return __mode; }
+
+	// writes the dirty pages back to the file (msync); only read_write
+	// mappings have any
+	void flush( bool async = false )
+	{
+		if (__fd < 0 or __mode != mmap_mode::read_write or __data == NULL)
+			return ;
+		if (msync(__data, detail::__round_to_pages(__size * sizeof(T)),
+					async ? MS_ASYNC : MS_SYNC) != 0)
+			__fail("msync");
+	}
+
+	// access pattern hint for the pages of every record
+	void advise( mmap_advice::type advice )
+	{ advise(advice, 0, __capacity); }
+
+	// access pattern hint for the pages of [pos, pos + count)
+	void advise( mmap_advice::type advice, size_type pos, size_type count )
+	{
+		if (__data == NULL or count == 0)
+			return ;
+		std::size_t	page = detail::__page_size();
+		std::size_t	first = pos * sizeof(T) & ~(page - 1);
+		std::size_t	last = ft::min(detail::__round_to_pages((pos + count) * sizeof(T)),
+									__mapped);
+		if (first >= last)
+			return ;
+		static const int	advices[] = {
+			MADV_NORMAL, MADV_SEQUENTIAL, MADV_RANDOM, MADV_WILLNEED, MADV_DONTNEED
+		};
+		// dropping the pages of a private or anonymous mapping zero-fills
+		// them, only a shared file mapping reads them back from the file
+		if (advice == mmap_advice::dont_need
+			and not (__fd >= 0 and __file_mapped and __mode != mmap_mode::copy_on_write))
+			return ;
+		if (madvise(reinterpret_cast<char *>(__data) + first, last - first,
+					advices[advice]) != 0)
+			__fail("madvise");
+	}
+
+	void assign( size_type count, const T& value )
+	{
+		T	tmp(value);
+		clear();
+		insert(end(), count, tmp);
+	}
+
+	template< class InputIt >
+	void assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{
+		clear();
+		insert(end(), first, last);
+	}
+
+	reference at( size_type pos )
+	{
+		if (pos >= __size)
+			throw std::out_of_range("mmap_vector");
+		return __data[pos];
+	}
+
+	const_reference at( size_type pos ) const
+	{
+		if (pos >= __size)
+			throw std::out_of_range("mmap_vector");
+		return __data[pos];
+	}
+
+	reference operator[]( size_type pos )
+	{ return __data[pos]; }
+
+	const_reference operator[]( size_type pos ) const
+	{ return __data[pos]; }
+
+	reference front()
+	{ return __data[0]; }
+
+	const_reference front() const
+	{ return __data[0]; }
+
+	reference back()
+	{ return __data[__size - 1]; }
+
+	const_reference back() const
+	{ return __data[__size - 1]; }
+
+	T* data()
+	{ return __data; }
+
+	const T* data() const
+	{ return __data; }
+
+	iterator begin()
+	{ return iterator(__data); }
+
+	const_iterator begin() const
+	{ return const_iterator(__data); }
+
+	iterator end()
+	{ return iterator(__data + __size); }
+
+	const_iterator end() const
+	{ return const_iterator(__data + __size); }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{ return std::numeric_limits<difference_type>::max() / sizeof(T); }
+
+	size_type capacity() const
+	{ return __capacity; }
+
+	void reserve( size_type new_cap )
+	{
+		__check_writable();
+		if (new_cap <= __capacity)
+			return ;
+		if (new_cap > max_size())
+			throw std::length_error("mmap_vector");
+		__remap(new_cap);
+	}
+
+	// gives the pages past the last record back, and the file space with
+	// them
+	void shrink_to_fit()
+	{
+		__check_writable();
+		if (__size == __capacity)
+			return ;
+		__remap(__size);
+	}
+
+	void clear()
+	{
+		__check_writable();
+		__size = 0;
+	}
+
+	void push_back( const T& value )
+	{
+		__check_writable();
+		if (__size == __capacity)
+		{
+			// value can be a record, the mapping may move
+			T	tmp(value);
+			__remap(__recommend(__size + 1));
+			__data[__size] = tmp;
+		}
+		else
+			__data[__size] = value;
+		++__size;
+	}
+
+# if FT_CXX11
+	template< class... Args >
+	void emplace_back( Args&&... args )
+	{ push_back(T(std::forward<Args>(args)...)); }
+# endif
+
+	void pop_back()
+	{
+		__check_writable();
+		--__size;
+	}
+
+	void resize( size_type count, T value = T() )
+	{
+		__check_writable();
+		if (count <= __size)
+		{
+			__size = count;
+			return ;
+		}
+		insert(end(), count - __size, value);
+	}
+
+	// new records are whatever the file or the zeroed pages hold
+	void resize_uninitialized( size_type count )
+	{
+		__check_writable();
+		if (count > __capacity)
+			__remap(__recommend(count));
+		__size = count;
+	}
+
+	void swap( mmap_vector& other )
+	{
+		ft::swap(__data, other.__data);
+		ft::swap(__size, other.__size);
+		ft::swap(__capacity, other.__capacity);
+		ft::swap(__mapped, other.__mapped);
+		ft::swap(__file_bytes, other.__file_bytes);
+		ft::swap(__fd, other.__fd);
+		ft::swap(__mode, other.__mode);
+		ft::swap(__file_mapped, other.__file_mapped);
+	}
+
+	iterator insert( iterator pos, const T& value )
+	{
+		size_type	n = pos - begin();
+		insert(pos, 1, value);
+		return iterator(__data + n);
+	}
+
+	void insert( iterator pos, size_type count, const T& value )
+	{
+		__check_writable();
+		size_type	n = pos - begin();
+		if (count == 0)
+			return ;
+		T	tmp(value);
+		__open_gap(n, count);
+		for (size_type i = 0; i < count; ++i)
+			__data[n + i] = tmp;
+		__size += count;
+	}
+
+	template< class InputIt >
+	void insert( iterator pos, typename enable_if<is_iterator<InputIt>::value,
+					InputIt>::type first, InputIt last )
+	{
+		__check_writable();
+		size_type	n = pos - begin();
+		size_type	count = ft::distance(first, last);
+		if (count == 0)
+			return ;
+		__open_gap(n, count);
+		detail::__uninitialized_copy(first, last, __data + n);
+		__size += count;
+	}
+
+	iterator erase( iterator pos )
+	{ return erase(pos, pos + 1); }
+
+	iterator erase( iterator first, iterator last )
+	{
+		__check_writable();
+		size_type	n = first - begin();
+		size_type	count = last - first;
+		if (count != 0)
+		{
+			std::memmove(static_cast<void *>(__data + n), __data + n + count,
+						(__size - n - count) * sizeof(T));
+			__size -= count;
+		}
+		return iterator(__data + n);
+	}
+
+private:
+	mmap_vector( const mmap_vector & );
+	mmap_vector &	operator=( const mmap_vector & );
+
+	static void	__fail( const char * call )
+	{
+		throw std::runtime_error(std::string("mmap_vector: ") + call + ": "
+								+ std::strerror(errno));
+	}
+
+	void		__check_writable() const
+	{
+		if (__mode == mmap_mode::read_only)
+			throw std::logic_error("mmap_vector: read only");
+	}
+
+	int			__protection() const
+	{ return __mode == mmap_mode::read_only ? PROT_READ : PROT_READ | PROT_WRITE; }
+
+	int			__flags() const
+	{ return __mode == mmap_mode::read_write ? MAP_SHARED : MAP_PRIVATE; }
+
+	size_type	__recommend( size_type new_size ) const
+	{
+		if (new_size > max_size())
+			throw std::length_error("mmap_vector");
+		if (__capacity >= max_size() / 2)
+			return max_size();
+		return ft::max(__capacity * 2, new_size);
+	}
+
+	// moves [pos, size) up by count, growing the mapping if needed
+	void		__open_gap( size_type pos, size_type count )
+	{
+		if (count > max_size() - __size)
+			throw std::length_error("mmap_vector");
+		if (__size + count > __capacity)
+			__remap(__recommend(__size + count));
+		std::memmove(static_cast<void *>(__data + pos + count), __data + pos,
+					(__size - pos) * sizeof(T));
+	}
+
+	// makes the mapping hold new_cap records, in whole pages
+	void		__remap( size_type new_cap )
+	{
+		std::size_t	bytes = detail::__round_to_pages(new_cap * sizeof(T));
+		if (bytes == (__data ? __mapped : 0))
+		{
+			__capacity = bytes / sizeof(T);
+			return ;
+		}
+		if (__fd >= 0 and __mode == mmap_mode::read_write)
+			__remap_file(bytes);
+		else if (__file_mapped and bytes > detail::__round_to_pages(__file_bytes))
+			__remap_private(bytes);
+		else
+			__remap_pages(bytes);
+		__capacity = bytes / sizeof(T);
+	}
+
+	// a shared mapping of the file: the file grows first so the new pages
+	// are backed, or shrinks once they are gone
+	void		__remap_file( std::size_t bytes )
+	{
+		if (bytes > __file_bytes and ftruncate(__fd, bytes) != 0)
+			__fail("ftruncate");
+		__remap_pages(bytes);
+		if (bytes < __file_bytes and ftruncate(__fd, bytes) != 0)
+			__fail("ftruncate");
+		__file_bytes = bytes;
+		__file_mapped = bytes != 0;
+	}
+
+	// a private mapping past the end of the file would fault, the records
+	// move to anonymous pages, which the file never sees anyway
+	void		__remap_private( std::size_t bytes )
+	{
+		void	*p = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+						MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (p == MAP_FAILED)
+			throw std::bad_alloc();
+		std::memcpy(p, __data, __size * sizeof(T));
+		munmap(__data, __mapped);
+		__data = static_cast<T *>(p);
+		__mapped = bytes;
+		__file_mapped = false;
+	}
+
+	// resizes the mapping as it is; without mremap, only the file mapping
+	// can be remapped without copying
+	void		__remap_pages( std::size_t bytes )
+	{
+		void	*p;
+		if (bytes == 0)
+			p = NULL;
+		else if (__data == NULL)
+		{
+			p = __fd >= 0 and __mode == mmap_mode::read_write
+				? mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, __fd, 0)
+				: mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (p == MAP_FAILED)
+				__fail("mmap");
+		}
+		else
+		{
+# ifdef __linux__
+			p = mremap(__data, __mapped, bytes, MREMAP_MAYMOVE);
+			if (p == MAP_FAILED)
+				__fail("mremap");
+# else
+			if (__fd >= 0 and __mode == mmap_mode::read_write)
+			{
+				munmap(__data, __mapped);
+				p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, __fd, 0);
+			}
+			else
+			{
+				p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, __flags() | MAP_ANONYMOUS,
+						-1, 0);
+				if (p != MAP_FAILED)
+				{
+					std::memcpy(p, __data, ft::min(__size * sizeof(T), bytes));
+					munmap(__data, __mapped);
+				}
+			}
+			if (p == MAP_FAILED)
+				__fail("mmap");
+# endif
+		}
+		if (p == NULL and __data != NULL)
+			munmap(__data, __mapped);
+		__data = static_cast<T *>(p);
+		__mapped = bytes;
+	}
+
+private:
+	T					*__data;
+	size_type			__size;
+	size_type			__capacity;
+	// bytes of the mapping, whole pages but for a file opened as it is
+	std::size_t			__mapped;
+	// size of the file, or of the file mapped privately
+	std::size_t			__file_bytes;
+	int					__fd;
+	mmap_mode::type		__mode;
+	// the mapping is (still) of the file
+	bool				__file_mapped;
+};
+
+template< class T >
+bool	operator==( const mmap_vector<T>& lhs, const mmap_vector<T>& rhs )
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template< class T >
+bool	operator!=( const mmap_vector<T>& lhs, const mmap_vector<T>& rhs )
+{
+	return !(lhs == rhs);
+}
+
+} // namespace ft
+
+
+namespace std
+{
+	template< class T >
+	void	swap( ft::mmap_vector<T>& lhs, ft::mmap_vector<T>& rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // FT_MMAP_VECTOR_HPP
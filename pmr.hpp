@@ -0,0 +1,638 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   pmr.hpp                                            :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 16:02:11 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 16:02:11 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_PMR_HPP
+# define FT_PMR_HPP
+
+# include <new>
+# include <cstddef>
+# include <cstdlib>
+# include <limits>
+# include <pthread.h>
+# include "utility.hpp"
+
+namespace ft
+{
+
+namespace pmr
+{
+
+class memory_resource
+{
+public:
+	static const std::size_t	max_align = 2 * sizeof(void *);
+
+	virtual ~memory_resource() {}
+
+	void *	allocate( std::size_t bytes, std::size_t alignment = max_align )
+	{ return do_allocate(bytes, alignment); }
+
+	void	deallocate( void * p, std::size_t bytes, std::size_t alignment = max_align )
+	{ do_deallocate(p, bytes, alignment); }
+
+	bool	is_equal( const memory_resource & other ) const
+	{ return do_is_equal(other); }
+
+private:
+	virtual void *	do_allocate( std::size_t bytes, std::size_t alignment ) = 0;
+	virtual void	do_deallocate( void * p, std::size_t bytes, std::size_t alignment ) = 0;
+	virtual bool	do_is_equal( const memory_resource & other ) const = 0;
+};
+
+inline bool	operator==( const memory_resource & lhs, const memory_resource & rhs )
+{
+	return &lhs == &rhs || lhs.is_equal(rhs);
+}
+
+inline bool	operator!=( const memory_resource & lhs, const memory_resource & rhs )
+{
+	return !(lhs == rhs);
+}
+
+
+
+namespace detail
+{
+	inline std::size_t	__align_up( std::size_t n, std::size_t alignment )
+	{
+		return (n + alignment - 1) & ~(alignment - 1);
+	}
+
+	inline std::size_t	__next_pow2( std::size_t n )
+	{
+		std::size_t	res = 1;
+		while (res < n)
+			res <<= 1;
+		return res;
+	}
+
+	class __new_delete_resource : public memory_resource
+	{
+	private:
+		void *	do_allocate( std::size_t bytes, std::size_t alignment )
+		{
+			if (alignment <= max_align)
+				return ::operator new(bytes);
+			void	*p = NULL;
+			if (posix_memalign(&p, alignment, bytes) != 0)
+				throw std::bad_alloc();
+			return p;
+		}
+
+		void	do_deallocate( void * p, std::size_t, std::size_t alignment )
+		{
+			if (alignment <= max_align)
+				::operator delete(p);
+			else
+				std::free(p);
+		}
+
+		bool	do_is_equal( const memory_resource & other ) const
+		{ return this == &other; }
+	};
+
+	class __null_memory_resource : public memory_resource
+	{
+	private:
+		void *	do_allocate( std::size_t, std::size_t )
+		{ throw std::bad_alloc(); }
+
+		void	do_deallocate( void *, std::size_t, std::size_t )
+		{}
+
+		bool	do_is_equal( const memory_resource & other ) const
+		{ return this == &other; }
+	};
+
+	inline memory_resource *&	__default_resource();
+}
+
+inline memory_resource *	new_delete_resource()
+{
+	static detail::__new_delete_resource	instance;
+	return &instance;
+}
+
+inline memory_resource *	null_memory_resource()
+{
+	static detail::__null_memory_resource	instance;
+	return &instance;
+}
+
+inline memory_resource *&	detail::__default_resource()
+{
+	static memory_resource	*res = new_delete_resource();
+	return res;
+}
+
+inline memory_resource *	get_default_resource()
+{
+	return detail::__default_resource();
+}
+
+inline memory_resource *	set_default_resource( memory_resource * r )
+{
+	memory_resource	*old = detail::__default_resource();
+	detail::__default_resource() = r ? r : new_delete_resource();
+	return old;
+}
+
+
+
+// Hands out memory by bumping a pointer through chunks taken from upstream.
+// deallocate() is a no-op, everything is given back at once by release()
+// or by the destructor.
+class monotonic_buffer_resource : public memory_resource
+{
+public:
+	explicit monotonic_buffer_resource( memory_resource * upstream = get_default_resource() ) :
+		__upstream(upstream), __chunks(NULL),
+		__initial_buffer(NULL), __initial_size(0),
+		__current(NULL), __left(0), __first_size(__min_chunk), __next_size(__first_size)
+	{}
+
+	explicit monotonic_buffer_resource( std::size_t initial_size,
+			memory_resource * upstream = get_default_resource() ) :
+		__upstream(upstream), __chunks(NULL),
+		__initial_buffer(NULL), __initial_size(0),
+		__current(NULL), __left(0),
+		__first_size(ft::max(initial_size, (std::size_t) __min_chunk)),
+		__next_size(__first_size)
+	{}
+
+	monotonic_buffer_resource( void * buffer, std::size_t buffer_size,
+			memory_resource * upstream = get_default_resource() ) :
+		__upstream(upstream), __chunks(NULL),
+		__initial_buffer(static_cast<char *>(buffer)), __initial_size(buffer_size),
+		__current(static_cast<char *>(buffer)), __left(buffer_size),
+		__first_size(ft::max(buffer_size * 2, (std::size_t) __min_chunk)),
+		__next_size(__first_size)
+	{}
+
+	~monotonic_buffer_resource()
+	{ release(); }
+
+	void	release()
+	{
+		while (__chunks)
+		{
+			__chunk	*next = __chunks->next;
+			__upstream->deallocate(__chunks, __chunks->size, __chunks->alignment);
+			__chunks = next;
+		}
+		__current = __initial_buffer;
+		__left = __initial_size;
+		// chunks grow again from the first size, not from where they stopped
+		__next_size = __first_size;
+	}
+
+	memory_resource *	upstream_resource() const
+	{ return __upstream; }
+
+private:
+	struct __chunk
+	{
+		__chunk		*next;
+		std::size_t	size;
+		std::size_t	alignment;
+	};
+
+	static const std::size_t	__min_chunk = 1024;
+
+	monotonic_buffer_resource( const monotonic_buffer_resource & );
+	monotonic_buffer_resource & operator=( const monotonic_buffer_resource & );
+
+	void *	do_allocate( std::size_t bytes, std::size_t alignment )
+	{
+		void	*res = __take(bytes, alignment);
+		if (res)
+			return res;
+		std::size_t	header = detail::__align_up(sizeof(__chunk), ft::max(alignment, (std::size_t) max_align));
+		std::size_t	size = ft::max(__next_size, header + bytes);
+		std::size_t	chunk_align = ft::max(alignment, (std::size_t) max_align);
+		__chunk		*chunk = static_cast<__chunk *>(__upstream->allocate(size, chunk_align));
+		chunk->next = __chunks;
+		chunk->size = size;
+		chunk->alignment = chunk_align;
+		__chunks = chunk;
+		__current = reinterpret_cast<char *>(chunk) + header;
+		__left = size - header;
+		if (__next_size < std::numeric_limits<std::size_t>::max() / 2)
+			__next_size <<= 1;
+		return __take(bytes, alignment);
+	}
+
+	void	do_deallocate( void *, std::size_t, std::size_t )
+	{}
+
+	bool	do_is_equal( const memory_resource & other ) const
+	{ return this == &other; }
+
+	void *	__take( std::size_t bytes, std::size_t alignment )
+	{
+		if (__current == NULL)
+			return NULL;
+		std::size_t	addr = reinterpret_cast<std::size_t>(__current);
+		std::size_t	pad = detail::__align_up(addr, alignment) - addr;
+		if (pad > __left or bytes > __left - pad)
+			return NULL;
+		void	*res = __current + pad;
+		__current += pad + bytes;
+		__left -= pad + bytes;
+		return res;
+	}
+
+	memory_resource	*__upstream;
+	__chunk			*__chunks;
+	char			*__initial_buffer;
+	std::size_t		__initial_size;
+	char			*__current;
+	std::size_t		__left;
+	std::size_t		__first_size;
+	std::size_t		__next_size;
+};
+
+
+
+struct pool_options
+{
+	std::size_t	max_blocks_per_chunk;
+	std::size_t	largest_required_pool_block;
+
+	pool_options() : max_blocks_per_chunk(0), largest_required_pool_block(0)
+	{}
+};
+
+// Keeps one free list per power of two block size. Requests above
+// largest_required_pool_block go straight to upstream.
+class unsynchronized_pool_resource : public memory_resource
+{
+public:
+	unsynchronized_pool_resource() :
+		__upstream(get_default_resource())
+	{ __init(pool_options()); }
+
+	explicit unsynchronized_pool_resource( memory_resource * upstream ) :
+		__upstream(upstream)
+	{ __init(pool_options()); }
+
+	explicit unsynchronized_pool_resource( const pool_options & opts,
+			memory_resource * upstream = get_default_resource() ) :
+		__upstream(upstream)
+	{ __init(opts); }
+
+	~unsynchronized_pool_resource()
+	{ release(); }
+
+	void	release()
+	{
+		for (std::size_t i = 0; i < __pool_count; ++i)
+		{
+			while (__pools[i].chunks)
+			{
+				__chunk	*next = __pools[i].chunks->next;
+				__upstream->deallocate(__pools[i].chunks, __pools[i].chunks->size,
+										__pools[i].chunks->alignment);
+				__pools[i].chunks = next;
+			}
+			__pools[i].free_list = NULL;
+			__pools[i].next_blocks = __min_blocks;
+		}
+		while (__large)
+		{
+			__large_header	*next = __large->next;
+			__upstream->deallocate(__large, __large->size, __large->alignment);
+			__large = next;
+		}
+	}
+
+	memory_resource *	upstream_resource() const
+	{ return __upstream; }
+
+	pool_options	options() const
+	{ return __opts; }
+
+private:
+	struct __block
+	{ __block	*next; };
+
+	struct __chunk
+	{
+		__chunk		*next;
+		std::size_t	size;
+		std::size_t	alignment;
+	};
+
+	struct __large_header
+	{
+		__large_header	*next;
+		__large_header	*prev;
+		std::size_t		size;
+		std::size_t		alignment;
+	};
+
+	struct __pool
+	{
+		__block		*free_list;
+		__chunk		*chunks;
+		std::size_t	next_blocks;
+	};
+
+	static const std::size_t	__min_block = sizeof(void *);
+	static const std::size_t	__min_blocks = 16;
+	static const std::size_t	__max_pools = 32;
+
+	unsynchronized_pool_resource( const unsynchronized_pool_resource & );
+	unsynchronized_pool_resource & operator=( const unsynchronized_pool_resource & );
+
+	void	__init( const pool_options & opts )
+	{
+		__opts = opts;
+		if (__opts.max_blocks_per_chunk == 0)
+			__opts.max_blocks_per_chunk = 1024;
+		__opts.max_blocks_per_chunk = ft::max(__opts.max_blocks_per_chunk, (std::size_t) __min_blocks);
+		if (__opts.largest_required_pool_block == 0)
+			__opts.largest_required_pool_block = 4096;
+		__opts.largest_required_pool_block = ft::min(
+				detail::__next_pow2(ft::max(__opts.largest_required_pool_block, (std::size_t) __min_block)),
+				__min_block << (__max_pools - 1));
+		__pool_count = 0;
+		for (std::size_t size = __min_block; size <= __opts.largest_required_pool_block; size <<= 1)
+		{
+			__pools[__pool_count].free_list = NULL;
+			__pools[__pool_count].chunks = NULL;
+			__pools[__pool_count].next_blocks = __min_blocks;
+			++__pool_count;
+		}
+		__large = NULL;
+	}
+
+	std::size_t	__block_size( std::size_t bytes, std::size_t alignment ) const
+	{
+		return detail::__next_pow2(ft::max(ft::max(bytes, alignment), (std::size_t) __min_block));
+	}
+
+	std::size_t	__pool_index( std::size_t block_size ) const
+	{
+		std::size_t	i = 0;
+		for (std::size_t size = __min_block; size < block_size; size <<= 1)
+			++i;
+		return i;
+	}
+
+	void	__refill( __pool & pool, std::size_t block_size )
+	{
+		std::size_t	chunk_align = ft::max(block_size, (std::size_t) max_align);
+		std::size_t	header = detail::__align_up(sizeof(__chunk), chunk_align);
+		std::size_t	size = header + pool.next_blocks * block_size;
+		__chunk		*chunk = static_cast<__chunk *>(__upstream->allocate(size, chunk_align));
+		chunk->next = pool.chunks;
+		chunk->size = size;
+		chunk->alignment = chunk_align;
+		pool.chunks = chunk;
+		char	*blocks = reinterpret_cast<char *>(chunk) + header;
+		for (std::size_t i = pool.next_blocks; i > 0; --i)
+		{
+			__block	*block = reinterpret_cast<__block *>(blocks + (i - 1) * block_size);
+			block->next = pool.free_list;
+			pool.free_list = block;
+		}
+		pool.next_blocks = ft::min(pool.next_blocks * 2, __opts.max_blocks_per_chunk);
+	}
+
+	void *	do_allocate( std::size_t bytes, std::size_t alignment )
+	{
+		std::size_t	block_size = __block_size(bytes, alignment);
+		if (block_size > __opts.largest_required_pool_block)
+		{
+			std::size_t		header = detail::__align_up(sizeof(__large_header),
+										ft::max(alignment, (std::size_t) max_align));
+			std::size_t		chunk_align = ft::max(alignment, (std::size_t) max_align);
+			__large_header	*large = static_cast<__large_header *>(
+								__upstream->allocate(header + bytes, chunk_align));
+			large->next = __large;
+			large->prev = NULL;
+			large->size = header + bytes;
+			large->alignment = chunk_align;
+			if (__large)
+				__large->prev = large;
+			__large = large;
+			return reinterpret_cast<char *>(large) + header;
+		}
+		__pool	&pool = __pools[__pool_index(block_size)];
+		if (pool.free_list == NULL)
+			__refill(pool, block_size);
+		__block	*res = pool.free_list;
+		pool.free_list = res->next;
+		return res;
+	}
+
+	void	do_deallocate( void * p, std::size_t bytes, std::size_t alignment )
+	{
+		if (p == NULL)
+			return ;
+		std::size_t	block_size = __block_size(bytes, alignment);
+		if (block_size > __opts.largest_required_pool_block)
+		{
+			std::size_t		header = detail::__align_up(sizeof(__large_header),
+										ft::max(alignment, (std::size_t) max_align));
+			__large_header	*large = reinterpret_cast<__large_header *>(
+								static_cast<char *>(p) - header);
+			if (large->prev)
+				large->prev->next = large->next;
+			else
+				__large = large->next;
+			if (large->next)
+				large->next->prev = large->prev;
+			__upstream->deallocate(large, large->size, large->alignment);
+			return ;
+		}
+		__pool	&pool = __pools[__pool_index(block_size)];
+		__block	*block = static_cast<__block *>(p);
+		block->next = pool.free_list;
+		pool.free_list = block;
+	}
+
+	bool	do_is_equal( const memory_resource & other ) const
+	{ return this == &other; }
+
+	memory_resource	*__upstream;
+	pool_options	__opts;
+	__pool			__pools[__max_pools];
+	std::size_t		__pool_count;
+	__large_header	*__large;
+};
+
+class synchronized_pool_resource : public memory_resource
+{
+public:
+	synchronized_pool_resource() : __pool()
+	{ pthread_mutex_init(&__mutex, NULL); }
+
+	explicit synchronized_pool_resource( memory_resource * upstream ) :
+		__pool(upstream)
+	{ pthread_mutex_init(&__mutex, NULL); }
+
+	explicit synchronized_pool_resource( const pool_options & opts,
+			memory_resource * upstream = get_default_resource() ) :
+		__pool(opts, upstream)
+	{ pthread_mutex_init(&__mutex, NULL); }
+
+	~synchronized_pool_resource()
+	{ pthread_mutex_destroy(&__mutex); }
+
+	void	release()
+	{
+		__lock_guard	lock(__mutex);
+		__pool.release();
+	}
+
+	memory_resource *	upstream_resource() const
+	{ return __pool.upstream_resource(); }
+
+	pool_options	options() const
+	{ return __pool.options(); }
+
+private:
+	struct __lock_guard
+	{
+		pthread_mutex_t	&m;
+		explicit __lock_guard( pthread_mutex_t & m ) : m(m)
+		{ pthread_mutex_lock(&m); }
+		~__lock_guard()
+		{ pthread_mutex_unlock(&m); }
+	};
+
+	synchronized_pool_resource( const synchronized_pool_resource & );
+	synchronized_pool_resource & operator=( const synchronized_pool_resource & );
+
+	void *	do_allocate( std::size_t bytes, std::size_t alignment )
+	{
+		__lock_guard	lock(__mutex);
+		return __pool.allocate(bytes, alignment);
+	}
+
+	void	do_deallocate( void * p, std::size_t bytes, std::size_t alignment )
+	{
+		__lock_guard	lock(__mutex);
+		__pool.deallocate(p, bytes, alignment);
+	}
+
+	bool	do_is_equal( const memory_resource & other ) const
+	{ return this == &other; }
+
+	unsynchronized_pool_resource	__pool;
+	pthread_mutex_t					__mutex;
+};
+
+
+
+template <class T>
+class polymorphic_allocator
+{
+public:
+	typedef T					value_type;
+	typedef T *					pointer;
+	typedef const T *			const_pointer;
+	typedef T &					reference;
+	typedef const T &			const_reference;
+	typedef std::size_t			size_type;
+	typedef std::ptrdiff_t		difference_type;
+
+	template <class U>
+	struct rebind
+	{ typedef polymorphic_allocator<U>	other; };
+
+	polymorphic_allocator() : __resource(get_default_resource())
+	{}
+
+	polymorphic_allocator( memory_resource * r ) :
+		__resource(r ? r : get_default_resource())
+	{}
+
+	polymorphic_allocator( const polymorphic_allocator & other ) :
+		__resource(other.__resource)
+	{}
+
+	template <class U>
+	polymorphic_allocator( const polymorphic_allocator<U> & other ) :
+		__resource(other.resource())
+	{}
+
+	pointer	allocate( size_type n, const void * = 0 )
+	{
+		if (n > max_size())
+			throw std::bad_alloc();
+		return static_cast<pointer>(__resource->allocate(n * sizeof(T), alignment_of<T>::value));
+	}
+
+	void	deallocate( pointer p, size_type n )
+	{ __resource->deallocate(p, n * sizeof(T), alignment_of<T>::value); }
+
+	void	construct( pointer p, const T & value )
+	{ ::new (static_cast<void *>(p)) T(value); }
+
+	void	destroy( pointer p )
+	{ p->~T(); }
+
+# if FT_CXX11
+	template <class U, class... Args>
+	void	construct( U * p, Args&&... args )
+	{ ::new (static_cast<void *>(p)) U(std::forward<Args>(args)...); }
+
+	template <class U>
+	void	destroy( U * p )
+	{ p->~U(); }
+# endif
+
+	size_type	max_size() const
+	{ return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+	pointer			address( reference x ) const
+	{ return &x; }
+
+	const_pointer	address( const_reference x ) const
+	{ return &x; }
+
+	memory_resource *	resource() const
+	{ return __resource; }
+
+private:
+	polymorphic_allocator & operator=( const polymorphic_allocator & );
+
+	memory_resource	*__resource;
+};
+
+template <class T1, class T2>
+bool	operator==( const polymorphic_allocator<T1> & lhs, const polymorphic_allocator<T2> & rhs )
+{
+	return *lhs.resource() == *rhs.resource();
+}
+
+template <class T1, class T2>
+bool	operator!=( const polymorphic_allocator<T1> & lhs, const polymorphic_allocator<T2> & rhs )
+{
+	return !(lhs == rhs);
+}
+
+template <class T>
+bool	deallocation_is_noop( const polymorphic_allocator<T> & alloc )
+{
+	return dynamic_cast<monotonic_buffer_resource *>(alloc.resource()) != NULL;
+}
+
+
+} // namespace pmr
+
+} // namespace ft
+
+#endif // FT_PMR_HPP
@@ -0,0 +1,418 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   priority_queue.hpp                                 :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:04:51 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 00:04:51 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_PRIORITY_QUEUE_HPP
+# define FT_PRIORITY_QUEUE_HPP
+
+# include <functional>
+# include <cstddef>
+# include <stdexcept>
+# include "utility.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+
+namespace detail
+{
+	// d-ary heap on [first, first + len): the children of i are
+	// Arity * i + 1 ... Arity * i + Arity. With 4 children a level is
+	// half as many cache lines down as with 2, and the 4 siblings compared
+	// at each step are next to each other in memory.
+
+	// moves value up from the hole at index hole
+	template <std::size_t Arity, class It, class T, class Compare>
+	void	__dary_sift_up( It first, std::ptrdiff_t hole, T value, Compare comp )
+	{
+		while (hole > 0)
+		{
+			std::ptrdiff_t	parent = (hole - 1) / Arity;
+			if (not comp(first[parent], value))
+				break ;
+			first[hole] = FT_MOVE(first[parent]);
+			hole = parent;
+		}
+		first[hole] = FT_MOVE(value);
+	}
+
+	// index of the child of parent that goes first, parent has at least one
+	template <std::size_t Arity, class It, class Compare>
+	std::ptrdiff_t	__dary_top_child( It first, std::ptrdiff_t parent, std::ptrdiff_t len,
+									Compare comp )
+	{
+		std::ptrdiff_t	child = Arity * parent + 1;
+		std::ptrdiff_t	last = ft::min(child + (std::ptrdiff_t)Arity, len);
+		std::ptrdiff_t	best = child;
+		for (++child; child < last; ++child)
+			if (comp(first[best], first[child]))
+				best = child;
+		return best;
+	}
+
+	// moves value down from the hole at index hole
+	template <std::size_t Arity, class It, class T, class Compare>
+	void	__dary_sift_down( It first, std::ptrdiff_t hole, std::ptrdiff_t len,
+							T value, Compare comp )
+	{
+		while (Arity * hole + 1 < (std::size_t)len)
+		{
+			std::ptrdiff_t	child = detail::__dary_top_child<Arity>(first, hole, len, comp);
+			if (not comp(value, first[child]))
+				break ;
+			first[hole] = FT_MOVE(first[child]);
+			hole = child;
+		}
+		first[hole] = FT_MOVE(value);
+	}
+
+	// same, for a value that most likely belongs near the leaves (the last
+	// element, after a pop): the hole goes down to a leaf along the top
+	// children without looking at value, which then climbs back up. Saves
+	// a comparison per level.
+	template <std::size_t Arity, class It, class T, class Compare>
+	void	__dary_sift_leaf( It first, std::ptrdiff_t hole, std::ptrdiff_t len,
+							T value, Compare comp )
+	{
+		std::ptrdiff_t	top = hole;
+		while (Arity * hole + 1 < (std::size_t)len)
+		{
+			std::ptrdiff_t	child = detail::__dary_top_child<Arity>(first, hole, len, comp);
+			first[hole] = FT_MOVE(first[child]);
+			hole = child;
+		}
+		while (hole > top)
+		{
+			std::ptrdiff_t	parent = (hole - 1) / Arity;
+			if (not comp(first[parent], value))
+				break ;
+			first[hole] = FT_MOVE(first[parent]);
+			hole = parent;
+		}
+		first[hole] = FT_MOVE(value);
+	}
+
+	// Floyd's bottom-up construction, O(n)
+	template <std::size_t Arity, class It, class Compare>
+	void	__dary_make_heap( It first, std::ptrdiff_t len, Compare comp )
+	{
+		typedef typename iterator_traits<It>::value_type	T;
+		if (len < 2)
+			return ;
+		for (std::ptrdiff_t parent = (len - 2) / Arity; parent >= 0; --parent)
+		{
+			T	value = FT_MOVE(first[parent]);
+			detail::__dary_sift_down<Arity>(first, parent, len, FT_MOVE(value), comp);
+		}
+	}
+}
+
+// Container adapter like std::priority_queue: top() is the element that
+// no other one compares greater than. The heap has Arity children per
+// node (4 by default), which halves its depth compared to a binary heap
+// and keeps the children of a node on one or two cache lines.
+template< class T, class Container = ft::vector<T>,
+		class Compare = std::less<typename Container::value_type>,
+		std::size_t Arity = 4 >
+class priority_queue
+{
+	typedef char	__arity_must_be_at_least_two[Arity >= 2 ? 1 : -1];
+protected:
+	Container	__container;
+	Compare		__comp;
+public:
+	typedef Container							container_type;
+	typedef Compare								value_compare;
+	typedef typename Container::value_type		value_type;
+	typedef typename Container::size_type		size_type;
+	typedef typename Container::reference		reference;
+	typedef typename Container::const_reference	const_reference;
+
+	static const std::size_t	arity = Arity;
+
+	// the elements of cont are heapified in O(n)
+	explicit priority_queue( const Compare& compare = Compare(),
+							const Container& cont = Container() ) :
+		__container(cont), __comp(compare)
+	{ __make_heap(); }
+
+	template< class InputIt >
+	priority_queue( InputIt first, InputIt last,
+					const Compare& compare = Compare(),
+					const Container& cont = Container() ) :
+		__container(cont), __comp(compare)
+	{
+		__container.insert(__container.end(), first, last);
+		__make_heap();
+	}
+
+# if FT_CXX11
+	priority_queue( const Compare& compare, Container&& cont ) :
+		__container(std::move(cont)), __comp(compare)
+	{ __make_heap(); }
+# endif
+
+	const_reference top() const
+	{ return __container.front(); }
+
+	bool empty() const
+	{ return __container.empty(); }
+
+	size_type size() const
+	{ return __container.size(); }
+
+	void push( const value_type& value )
+	{
+		__container.push_back(value);
+		__push_heap();
+	}
+
+# if FT_CXX11
+	void push( value_type&& value )
+	{
+		__container.push_back(std::move(value));
+		__push_heap();
+	}
+
+	template< class... Args >
+	void emplace( Args&&... args )
+	{
+		__container.emplace_back(std::forward<Args>(args)...);
+		__push_heap();
+	}
+# endif
+
+	void pop()
+	{
+		std::ptrdiff_t	len = __container.size() - 1;
+		if (len > 0)
+		{
+			value_type	value = FT_MOVE(__container[len]);
+			__container[len] = FT_MOVE(__container[0]);
+			detail::__dary_sift_leaf<Arity>(__container.begin(), 0, len,
+											FT_MOVE(value), __comp);
+		}
+		__container.pop_back();
+	}
+
+	void swap( priority_queue& other )
+	{
+		__container.swap(other.__container);
+		ft::swap(__comp, other.__comp);
+	}
+
+private:
+	void	__make_heap()
+	{
+		detail::__dary_make_heap<Arity>(__container.begin(),
+										(std::ptrdiff_t)__container.size(), __comp);
+	}
+
+	void	__push_heap()
+	{
+		std::ptrdiff_t	hole = __container.size() - 1;
+		value_type		value = FT_MOVE(__container[hole]);
+		detail::__dary_sift_up<Arity>(__container.begin(), hole, FT_MOVE(value), __comp);
+	}
+};
+
+template< class T, class Container, class Compare, std::size_t Arity >
+const std::size_t	priority_queue<T, Container, Compare, Arity>::arity;
+
+
+// Priority queue of ids 0, 1, 2... each with a priority, for Dijkstra or
+// a scheduler: the priority of an id already queued can be changed in
+// O(log n), the heap keeps the position of every id.
+// The heap only moves ids, the priorities stay in a table indexed by id.
+// With Compare = std::greater<T> top_id() has the smallest priority and
+// decrease_key lowers it, the usual setting for shortest paths.
+template< class T, class Compare = std::less<T>, std::size_t Arity = 4 >
+class indexed_priority_queue
+{
+	typedef char	__arity_must_be_at_least_two[Arity >= 2 ? 1 : -1];
+public:
+	typedef T				value_type;
+	typedef Compare			value_compare;
+	typedef std::size_t		size_type;
+	typedef std::size_t		id_type;
+
+	static const size_type	npos = static_cast<size_type>(-1);
+
+	// ids below ids need no table growth
+	explicit indexed_priority_queue( size_type ids = 0, const Compare& compare = Compare() ) :
+		__heap(), __keys(ids), __position(ids, npos), __comp(compare)
+	{ __heap.reserve(ids); }
+
+	bool empty() const
+	{ return __heap.empty(); }
+
+	size_type size() const
+	{ return __heap.size(); }
+
+	bool contains( id_type id ) const
+	{ return id < __position.size() and __position[id] != npos; }
+
+	id_type top_id() const
+	{ return __heap.front(); }
+
+	const value_type& top() const
+	{ return __keys[__heap.front()]; }
+
+	const value_type& priority( id_type id ) const
+	{ return __keys[id]; }
+
+	// id must not be queued yet
+	void push( id_type id, const value_type& key )
+	{
+		if (id >= __position.size())
+		{
+			__keys.resize(id + 1);
+			__position.resize(id + 1, npos);
+		}
+		__keys[id] = key;
+		__heap.push_back(id);
+		__position[id] = __heap.size() - 1;
+		__sift_up(__heap.size() - 1);
+	}
+
+	void pop()
+	{ erase(__heap.front()); }
+
+	// removes a queued id
+	void erase( id_type id )
+	{
+		size_type	hole = __position[id];
+		id_type		last = __heap.back();
+		__heap.pop_back();
+		__position[id] = npos;
+		if (last == id)
+			return ;
+		__heap[hole] = last;
+		__position[last] = hole;
+		__sift_up(hole);
+		__sift_down(__position[last]);
+	}
+
+	// key must not go after the current priority of id (compare it with
+	// Compare), the id can only move towards the top
+	void decrease_key( id_type id, const value_type& key )
+	{
+		__keys[id] = key;
+		__sift_up(__position[id]);
+	}
+
+	// any new priority, the id moves up or down
+	void update( id_type id, const value_type& key )
+	{
+		bool	up = __comp(__keys[id], key);
+		__keys[id] = key;
+		if (up)
+			__sift_up(__position[id]);
+		else
+			__sift_down(__position[id]);
+	}
+
+	// pushes id, or updates its priority if it is queued
+	void push_or_update( id_type id, const value_type& key )
+	{
+		if (contains(id))
+			update(id, key);
+		else
+			push(id, key);
+	}
+
+	void clear()
+	{
+		for (size_type i = 0; i != __heap.size(); ++i)
+			__position[__heap[i]] = npos;
+		__heap.clear();
+	}
+
+	void swap( indexed_priority_queue& other )
+	{
+		__heap.swap(other.__heap);
+		__keys.swap(other.__keys);
+		__position.swap(other.__position);
+		ft::swap(__comp, other.__comp);
+	}
+
+private:
+	bool	__before( id_type a, id_type b ) const
+	{ return __comp(__keys[b], __keys[a]); }
+
+	void	__sift_up( size_type hole )
+	{
+		id_type	id = __heap[hole];
+		while (hole > 0)
+		{
+			size_type	parent = (hole - 1) / Arity;
+			if (not __before(id, __heap[parent]))
+				break ;
+			__heap[hole] = __heap[parent];
+			__position[__heap[hole]] = hole;
+			hole = parent;
+		}
+		__heap[hole] = id;
+		__position[id] = hole;
+	}
+
+	void	__sift_down( size_type hole )
+	{
+		id_type		id = __heap[hole];
+		size_type	len = __heap.size();
+		while (Arity * hole + 1 < len)
+		{
+			size_type	child = Arity * hole + 1;
+			size_type	last = ft::min(child + Arity, len);
+			size_type	best = child;
+			for (++child; child < last; ++child)
+				if (__before(__heap[child], __heap[best]))
+					best = child;
+			if (not __before(__heap[best], id))
+				break ;
+			__heap[hole] = __heap[best];
+			__position[__heap[hole]] = hole;
+			hole = best;
+		}
+		__heap[hole] = id;
+		__position[id] = hole;
+	}
+
+	ft::vector<id_type>		__heap;
+	ft::vector<value_type>	__keys;
+	ft::vector<size_type>	__position;
+	Compare					__comp;
+};
+
+template< class T, class Compare, std::size_t Arity >
+const typename indexed_priority_queue<T, Compare, Arity>::size_type
+	indexed_priority_queue<T, Compare, Arity>::npos;
+
+} // namespace ft
+
+namespace std
+{
+	template< class T, class Container, class Compare, std::size_t Arity >
+	void	swap( ft::priority_queue<T, Container, Compare, Arity> & lhs,
+				ft::priority_queue<T, Container, Compare, Arity> & rhs )
+	{
+		lhs.swap(rhs);
+	}
+
+	template< class T, class Compare, std::size_t Arity >
+	void	swap( ft::indexed_priority_queue<T, Compare, Arity> & lhs,
+				ft::indexed_priority_queue<T, Compare, Arity> & rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // FT_PRIORITY_QUEUE_HPP
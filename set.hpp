@@ -71,7 +71,7 @@ public:
 	template< class InputIt >
 	set( InputIt first, InputIt last,
 		const Compare& comp = Compare(),
-		const Allocator& alloc = Allocator() )
+		const Allocator& alloc = Allocator() ) : __tree(comp, alloc)
 	{
 		for (; first != last; ++first)
 			__tree.insert(*first);
@@ -86,6 +86,17 @@ public:
 		return *this;
 	}
 
+# if FT_CXX11
+	set( set&& other ) noexcept : __tree(std::move(other.__tree))
+	{}
+
+	set& operator=( set&& other )
+	{
+		__tree = std::move(other.__tree);
+		return *this;
+	}
+# endif
+
 	allocator_type get_allocator() const
 	{ return __tree.get_allocator(); }
 
@@ -132,6 +143,22 @@ public:
 	void insert( InputIt first, InputIt last )
 	{ __tree.insert(first, last); }
 
+# if FT_CXX11
+	ft::pair<iterator,bool> insert( value_type&& value )
+	{ return __tree.insert(std::move(value)); }
+
+	iterator insert( iterator hint, value_type&& value )
+	{ return __tree.insert(hint, std::move(value)); }
+
+	template< class... Args >
+	ft::pair<iterator,bool> emplace( Args&&... args )
+	{ return __tree.emplace(std::forward<Args>(args)...); }
+
+	template< class... Args >
+	iterator emplace_hint( iterator hint, Args&&... args )
+	{ return __tree.emplace_hint(hint, std::forward<Args>(args)...); }
+# endif
+
 	void erase( iterator pos )
 	{ __tree.erase(pos); }
 
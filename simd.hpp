@@ -0,0 +1,744 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   simd.hpp                                           :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 12:31:05 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 12:31:05 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SIMD_HPP
+# define FT_SIMD_HPP
+
+# include <cstddef>
+# include <climits>
+# include <stdint.h>
+# if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#  define FT_SIMD_X86 1
+#  include <immintrin.h>
+#  define FT_TARGET_AVX2 __attribute__((target("avx2")))
+#  define FT_TARGET_POPCNT __attribute__((target("popcnt")))
+# else
+#  define FT_SIMD_X86 0
+# endif
+
+// Vector kernels over plain arrays.
+// The comparison kernels pick their instruction set when the including
+// file is compiled (SSE2 is the x86-64 default, -mavx/-mavx2 or
+// -march=native enable the wider paths). The kernels of the algorithms
+// (find, count, replace, minmax, sum) and the bit word kernels of
+// vector<bool> are built for both SSE2 and AVX2 (and POPCNT) and choose
+// at run time from CPUID. Other targets use scalar loops.
+
+namespace ft
+{
+
+namespace detail
+{
+	// index of the first byte where a and b differ, n if there is none
+	inline std::size_t	__mismatch_bytes( const void * a, const void * b, std::size_t n )
+	{
+		const unsigned char	*p = static_cast<const unsigned char *>(a);
+		const unsigned char	*q = static_cast<const unsigned char *>(b);
+		std::size_t			i = 0;
+# if defined(__AVX2__)
+		for (; n - i >= 32; i += 32)
+		{
+			__m256i		x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+			__m256i		y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(q + i));
+			unsigned	mask = ~static_cast<unsigned>(
+								_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+# endif
+# if defined(__SSE2__)
+		for (; n - i >= 16; i += 16)
+		{
+			__m128i		x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+			__m128i		y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(q + i));
+			unsigned	mask = ~static_cast<unsigned>(
+								_mm_movemask_epi8(_mm_cmpeq_epi8(x, y))) & 0xFFFF;
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+# endif
+		for (; i < n; ++i)
+			if (p[i] != q[i])
+				return i;
+		return n;
+	}
+
+	// Index of the first position where a and b differ, n if there is none.
+	// With ordered, "differ" means a[i] < b[i] or b[i] < a[i] (a NaN is
+	// equivalent to everything), otherwise !(a[i] == b[i]) (a NaN differs
+	// from everything, itself included).
+	inline std::size_t	__mismatch_float( const float * a, const float * b,
+										std::size_t n, bool ordered )
+	{
+		std::size_t	i = 0;
+# if defined(__AVX__)
+		for (; n - i >= 8; i += 8)
+		{
+			__m256		x = _mm256_loadu_ps(a + i);
+			__m256		y = _mm256_loadu_ps(b + i);
+			unsigned	mask = ordered
+				? _mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_NEQ_OQ))
+				: _mm256_movemask_ps(_mm256_cmp_ps(x, y, _CMP_NEQ_UQ));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+# endif
+# if defined(__SSE2__)
+		for (; n - i >= 4; i += 4)
+		{
+			__m128		x = _mm_loadu_ps(a + i);
+			__m128		y = _mm_loadu_ps(b + i);
+			__m128		neq = _mm_cmpneq_ps(x, y);
+			if (ordered)
+				neq = _mm_and_ps(neq, _mm_cmpord_ps(x, y));
+			unsigned	mask = _mm_movemask_ps(neq);
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+# endif
+		for (; i < n; ++i)
+			if (ordered ? (a[i] < b[i] or b[i] < a[i]) : !(a[i] == b[i]))
+				return i;
+		return n;
+	}
+
+	inline std::size_t	__mismatch_float( const double * a, const double * b,
+										std::size_t n, bool ordered )
+	{
+		std::size_t	i = 0;
+# if defined(__AVX__)
+		for (; n - i >= 4; i += 4)
+		{
+			__m256d		x = _mm256_loadu_pd(a + i);
+			__m256d		y = _mm256_loadu_pd(b + i);
+			unsigned	mask = ordered
+				? _mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_NEQ_OQ))
+				: _mm256_movemask_pd(_mm256_cmp_pd(x, y, _CMP_NEQ_UQ));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+# endif
+# if defined(__SSE2__)
+		for (; n - i >= 2; i += 2)
+		{
+			__m128d		x = _mm_loadu_pd(a + i);
+			__m128d		y = _mm_loadu_pd(b + i);
+			__m128d		neq = _mm_cmpneq_pd(x, y);
+			if (ordered)
+				neq = _mm_and_pd(neq, _mm_cmpord_pd(x, y));
+			unsigned	mask = _mm_movemask_pd(neq);
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+# endif
+		for (; i < n; ++i)
+			if (ordered ? (a[i] < b[i] or b[i] < a[i]) : !(a[i] == b[i]))
+				return i;
+		return n;
+	}
+
+	// Kernels over 32-bit integers and floats. The integer ones only look
+	// at bits, so they serve int and unsigned int alike; minmax takes the
+	// value xor-ed into every element (INT_MIN for unsigned) so a signed
+	// comparison gives the unsigned order.
+
+	// hints that *p will be read soon; a no-op where there is no builtin
+	inline void	__prefetch( const void * p )
+	{
+# if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(p);
+# else
+		(void)p;
+# endif
+	}
+
+	// lanes are counted in 32 bits, the counts are flushed before they wrap
+	static const std::size_t	__count_block = std::size_t(1) << 30;
+
+	inline std::size_t	__find_scalar( const int * p, std::size_t n, int value )
+	{
+		for (std::size_t i = 0; i < n; ++i)
+			if (p[i] == value)
+				return i;
+		return n;
+	}
+
+	inline std::size_t	__find_scalar( const float * p, std::size_t n, float value )
+	{
+		for (std::size_t i = 0; i < n; ++i)
+			if (p[i] == value)
+				return i;
+		return n;
+	}
+
+# if FT_SIMD_X86
+	inline bool	__cpu_has_avx2()
+	{
+		static const bool	has = __builtin_cpu_supports("avx2");
+		return has;
+	}
+
+	// find
+
+	inline std::size_t	__find_sse2( const int * p, std::size_t n, int value )
+	{
+		__m128i		v = _mm_set1_epi32(value);
+		std::size_t	i = 0;
+		for (; n - i >= 4; i += 4)
+		{
+			__m128i	x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+			int		mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, v)));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+		return i + __find_scalar(p + i, n - i, value);
+	}
+
+	FT_TARGET_AVX2
+	inline std::size_t	__find_avx2( const int * p, std::size_t n, int value )
+	{
+		__m256i		v = _mm256_set1_epi32(value);
+		std::size_t	i = 0;
+		for (; n - i >= 8; i += 8)
+		{
+			__m256i	x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+			int		mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, v)));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+		return i + __find_scalar(p + i, n - i, value);
+	}
+
+	inline std::size_t	__find_sse2( const float * p, std::size_t n, float value )
+	{
+		__m128		v = _mm_set1_ps(value);
+		std::size_t	i = 0;
+		for (; n - i >= 4; i += 4)
+		{
+			int	mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+		return i + __find_scalar(p + i, n - i, value);
+	}
+
+	FT_TARGET_AVX2
+	inline std::size_t	__find_avx2( const float * p, std::size_t n, float value )
+	{
+		__m256		v = _mm256_set1_ps(value);
+		std::size_t	i = 0;
+		for (; n - i >= 8; i += 8)
+		{
+			int	mask = _mm256_movemask_ps(_mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_EQ_OQ));
+			if (mask != 0)
+				return i + __builtin_ctz(mask);
+		}
+		return i + __find_scalar(p + i, n - i, value);
+	}
+
+	// last occurrence, n if there is none
+
+	inline std::size_t	__find_last_sse2( const int * p, std::size_t n, int value )
+	{
+		__m128i		v = _mm_set1_epi32(value);
+		std::size_t	i = n;
+		for (; i >= 4; i -= 4)
+		{
+			__m128i	x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i - 4));
+			int		mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(x, v)));
+			if (mask != 0)
+				return i - 4 + 31 - __builtin_clz(mask);
+		}
+		while (i != 0)
+			if (p[--i] == value)
+				return i;
+		return n;
+	}
+
+	FT_TARGET_AVX2
+	inline std::size_t	__find_last_avx2( const int * p, std::size_t n, int value )
+	{
+		__m256i		v = _mm256_set1_epi32(value);
+		std::size_t	i = n;
+		for (; i >= 8; i -= 8)
+		{
+			__m256i	x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i - 8));
+			int		mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(x, v)));
+			if (mask != 0)
+				return i - 8 + 31 - __builtin_clz(mask);
+		}
+		while (i != 0)
+			if (p[--i] == value)
+				return i;
+		return n;
+	}
+
+	// count
+
+	inline std::size_t	__count_sse2( const int * p, std::size_t n, int value )
+	{
+		__m128i		v = _mm_set1_epi32(value);
+		std::size_t	res = 0;
+		std::size_t	i = 0;
+		while (n - i >= 4)
+		{
+			__m128i		acc = _mm_setzero_si128();
+			std::size_t	end = n - i > __count_block ? i + __count_block : n;
+			for (; end - i >= 4; i += 4)
+			{
+				__m128i	x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+				acc = _mm_sub_epi32(acc, _mm_cmpeq_epi32(x, v));
+			}
+			unsigned	lanes[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+			res += std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+		}
+		for (; i < n; ++i)
+			res += p[i] == value;
+		return res;
+	}
+
+	FT_TARGET_AVX2
+	inline std::size_t	__count_avx2( const int * p, std::size_t n, int value )
+	{
+		__m256i		v = _mm256_set1_epi32(value);
+		std::size_t	res = 0;
+		std::size_t	i = 0;
+		while (n - i >= 8)
+		{
+			__m256i		acc = _mm256_setzero_si256();
+			std::size_t	end = n - i > __count_block ? i + __count_block : n;
+			for (; end - i >= 8; i += 8)
+			{
+				__m256i	x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+				acc = _mm256_sub_epi32(acc, _mm256_cmpeq_epi32(x, v));
+			}
+			unsigned	lanes[8];
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc);
+			for (int k = 0; k < 8; ++k)
+				res += lanes[k];
+		}
+		for (; i < n; ++i)
+			res += p[i] == value;
+		return res;
+	}
+
+	inline std::size_t	__count_sse2( const float * p, std::size_t n, float value )
+	{
+		__m128		v = _mm_set1_ps(value);
+		std::size_t	res = 0;
+		std::size_t	i = 0;
+		while (n - i >= 4)
+		{
+			__m128i		acc = _mm_setzero_si128();
+			std::size_t	end = n - i > __count_block ? i + __count_block : n;
+			for (; end - i >= 4; i += 4)
+				acc = _mm_sub_epi32(acc,
+						_mm_castps_si128(_mm_cmpeq_ps(_mm_loadu_ps(p + i), v)));
+			unsigned	lanes[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+			res += std::size_t(lanes[0]) + lanes[1] + lanes[2] + lanes[3];
+		}
+		for (; i < n; ++i)
+			res += p[i] == value;
+		return res;
+	}
+
+	FT_TARGET_AVX2
+	inline std::size_t	__count_avx2( const float * p, std::size_t n, float value )
+	{
+		__m256		v = _mm256_set1_ps(value);
+		std::size_t	res = 0;
+		std::size_t	i = 0;
+		while (n - i >= 8)
+		{
+			__m256i		acc = _mm256_setzero_si256();
+			std::size_t	end = n - i > __count_block ? i + __count_block : n;
+			for (; end - i >= 8; i += 8)
+				acc = _mm256_sub_epi32(acc, _mm256_castps_si256(
+						_mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_EQ_OQ)));
+			unsigned	lanes[8];
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), acc);
+			for (int k = 0; k < 8; ++k)
+				res += lanes[k];
+		}
+		for (; i < n; ++i)
+			res += p[i] == value;
+		return res;
+	}
+
+	// replace
+
+	inline void	__replace_sse2( int * p, std::size_t n, int old_value, int new_value )
+	{
+		__m128i		o = _mm_set1_epi32(old_value);
+		__m128i		r = _mm_set1_epi32(new_value);
+		std::size_t	i = 0;
+		for (; n - i >= 4; i += 4)
+		{
+			__m128i	x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i));
+			__m128i	m = _mm_cmpeq_epi32(x, o);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(p + i),
+				_mm_or_si128(_mm_and_si128(m, r), _mm_andnot_si128(m, x)));
+		}
+		for (; i < n; ++i)
+			if (p[i] == old_value)
+				p[i] = new_value;
+	}
+
+	FT_TARGET_AVX2
+	inline void	__replace_avx2( int * p, std::size_t n, int old_value, int new_value )
+	{
+		__m256i		o = _mm256_set1_epi32(old_value);
+		__m256i		r = _mm256_set1_epi32(new_value);
+		std::size_t	i = 0;
+		for (; n - i >= 8; i += 8)
+		{
+			__m256i	x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(p + i),
+				_mm256_blendv_epi8(x, r, _mm256_cmpeq_epi32(x, o)));
+		}
+		for (; i < n; ++i)
+			if (p[i] == old_value)
+				p[i] = new_value;
+	}
+
+	inline void	__replace_sse2( float * p, std::size_t n, float old_value, float new_value )
+	{
+		__m128		o = _mm_set1_ps(old_value);
+		__m128		r = _mm_set1_ps(new_value);
+		std::size_t	i = 0;
+		for (; n - i >= 4; i += 4)
+		{
+			__m128	x = _mm_loadu_ps(p + i);
+			__m128	m = _mm_cmpeq_ps(x, o);
+			_mm_storeu_ps(p + i, _mm_or_ps(_mm_and_ps(m, r), _mm_andnot_ps(m, x)));
+		}
+		for (; i < n; ++i)
+			if (p[i] == old_value)
+				p[i] = new_value;
+	}
+
+	FT_TARGET_AVX2
+	inline void	__replace_avx2( float * p, std::size_t n, float old_value, float new_value )
+	{
+		__m256		o = _mm256_set1_ps(old_value);
+		__m256		r = _mm256_set1_ps(new_value);
+		std::size_t	i = 0;
+		for (; n - i >= 8; i += 8)
+		{
+			__m256	x = _mm256_loadu_ps(p + i);
+			_mm256_storeu_ps(p + i,
+				_mm256_blendv_ps(x, r, _mm256_cmp_ps(x, o, _CMP_EQ_OQ)));
+		}
+		for (; i < n; ++i)
+			if (p[i] == old_value)
+				p[i] = new_value;
+	}
+
+	// min and max values of n > 0 elements, compared after xor with bias
+
+	inline void	__minmax_sse2( const int * p, std::size_t n, int bias, int & mn, int & mx )
+	{
+		std::size_t	i = 0;
+		mn = p[0] ^ bias;
+		mx = mn;
+		if (n >= 4)
+		{
+			__m128i	b = _mm_set1_epi32(bias);
+			__m128i	vmin = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p)), b);
+			__m128i	vmax = vmin;
+			for (i = 4; n - i >= 4; i += 4)
+			{
+				__m128i	x = _mm_xor_si128(
+							_mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)), b);
+				__m128i	lt = _mm_cmplt_epi32(x, vmin);
+				__m128i	gt = _mm_cmpgt_epi32(x, vmax);
+				vmin = _mm_or_si128(_mm_and_si128(lt, x), _mm_andnot_si128(lt, vmin));
+				vmax = _mm_or_si128(_mm_and_si128(gt, x), _mm_andnot_si128(gt, vmax));
+			}
+			int	lanes_min[4], lanes_max[4];
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes_min), vmin);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes_max), vmax);
+			for (int k = 0; k < 4; ++k)
+			{
+				mn = lanes_min[k] < mn ? lanes_min[k] : mn;
+				mx = lanes_max[k] > mx ? lanes_max[k] : mx;
+			}
+		}
+		for (; i < n; ++i)
+		{
+			int	x = p[i] ^ bias;
+			mn = x < mn ? x : mn;
+			mx = x > mx ? x : mx;
+		}
+		mn ^= bias;
+		mx ^= bias;
+	}
+
+	FT_TARGET_AVX2
+	inline void	__minmax_avx2( const int * p, std::size_t n, int bias, int & mn, int & mx )
+	{
+		std::size_t	i = 0;
+		mn = p[0] ^ bias;
+		mx = mn;
+		if (n >= 8)
+		{
+			__m256i	b = _mm256_set1_epi32(bias);
+			__m256i	vmin = _mm256_xor_si256(
+							_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p)), b);
+			__m256i	vmax = vmin;
+			for (i = 8; n - i >= 8; i += 8)
+			{
+				__m256i	x = _mm256_xor_si256(
+							_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)), b);
+				vmin = _mm256_min_epi32(vmin, x);
+				vmax = _mm256_max_epi32(vmax, x);
+			}
+			int	lanes_min[8], lanes_max[8];
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes_min), vmin);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes_max), vmax);
+			for (int k = 0; k < 8; ++k)
+			{
+				mn = lanes_min[k] < mn ? lanes_min[k] : mn;
+				mx = lanes_max[k] > mx ? lanes_max[k] : mx;
+			}
+		}
+		for (; i < n; ++i)
+		{
+			int	x = p[i] ^ bias;
+			mn = x < mn ? x : mn;
+			mx = x > mx ? x : mx;
+		}
+		mn ^= bias;
+		mx ^= bias;
+	}
+
+	// wrapping sum
+
+	inline unsigned	__sum_sse2( const int * p, std::size_t n )
+	{
+		__m128i		acc = _mm_setzero_si128();
+		std::size_t	i = 0;
+		for (; n - i >= 4; i += 4)
+			acc = _mm_add_epi32(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(p + i)));
+		unsigned	lanes[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+		unsigned	res = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+		for (const int * q = p + i; q != p + n; ++q)
+			res += static_cast<unsigned>(*q);
+		return res;
+	}
+
+	FT_TARGET_AVX2
+	inline unsigned	__sum_avx2( const int * p, std::size_t n )
+	{
+		__m256i		acc0 = _mm256_setzero_si256();
+		__m256i		acc1 = _mm256_setzero_si256();
+		std::size_t	i = 0;
+		for (; n - i >= 16; i += 16)
+		{
+			acc0 = _mm256_add_epi32(acc0,
+						_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i)));
+			acc1 = _mm256_add_epi32(acc1,
+						_mm256_loadu_si256(reinterpret_cast<const __m256i *>(p + i + 8)));
+		}
+		unsigned	lanes[8];
+		_mm256_storeu_si256(reinterpret_cast<__m256i *>(lanes), _mm256_add_epi32(acc0, acc1));
+		unsigned	res = 0;
+		for (int k = 0; k < 8; ++k)
+			res += lanes[k];
+		for (const int * q = p + i; q != p + n; ++q)
+			res += static_cast<unsigned>(*q);
+		return res;
+	}
+
+	// bit words
+
+	inline bool	__cpu_has_popcnt()
+	{
+		static const bool	has = __builtin_cpu_supports("popcnt");
+		return has;
+	}
+
+	// without -mpopcnt, __builtin_popcountll is a library call
+	FT_TARGET_POPCNT
+	inline std::size_t	__popcount_words_popcnt( const uint64_t * p, std::size_t n )
+	{
+		std::size_t	res0 = 0;
+		std::size_t	res1 = 0;
+		std::size_t	i = 0;
+		for (; n - i >= 2; i += 2)
+		{
+			res0 += __builtin_popcountll(p[i]);
+			res1 += __builtin_popcountll(p[i + 1]);
+		}
+		if (i != n)
+			res0 += __builtin_popcountll(p[i]);
+		return res0 + res1;
+	}
+
+	// Op: 0 and, 1 or, 2 xor
+	template <int Op>
+	inline void	__bitwise_words_sse2( uint64_t * dst, const uint64_t * src, std::size_t n )
+	{
+		std::size_t	i = 0;
+		for (; n - i >= 2; i += 2)
+		{
+			__m128i	x = _mm_loadu_si128(reinterpret_cast<const __m128i *>(dst + i));
+			__m128i	y = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+			x = Op == 0 ? _mm_and_si128(x, y) : Op == 1 ? _mm_or_si128(x, y) : _mm_xor_si128(x, y);
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), x);
+		}
+		if (i != n)
+			dst[i] = Op == 0 ? dst[i] & src[i] : Op == 1 ? dst[i] | src[i] : dst[i] ^ src[i];
+	}
+
+	template <int Op>
+	FT_TARGET_AVX2
+	inline void	__bitwise_words_avx2( uint64_t * dst, const uint64_t * src, std::size_t n )
+	{
+		std::size_t	i = 0;
+		for (; n - i >= 4; i += 4)
+		{
+			__m256i	x = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(dst + i));
+			__m256i	y = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+			x = Op == 0 ? _mm256_and_si256(x, y)
+				: Op == 1 ? _mm256_or_si256(x, y) : _mm256_xor_si256(x, y);
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), x);
+		}
+		for (; i != n; ++i)
+			dst[i] = Op == 0 ? dst[i] & src[i] : Op == 1 ? dst[i] | src[i] : dst[i] ^ src[i];
+	}
+# endif
+
+	// entry points, dispatched on the CPU
+
+	template <class T>
+	std::size_t	__find( const T * p, std::size_t n, T value )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_avx2())
+			return __find_avx2(p, n, value);
+		return __find_sse2(p, n, value);
+# else
+		return __find_scalar(p, n, value);
+# endif
+	}
+
+	inline std::size_t	__find_last( const int * p, std::size_t n, int value )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_avx2())
+			return __find_last_avx2(p, n, value);
+		return __find_last_sse2(p, n, value);
+# else
+		for (std::size_t i = n; i != 0; --i)
+			if (p[i - 1] == value)
+				return i - 1;
+		return n;
+# endif
+	}
+
+	template <class T>
+	std::size_t	__count( const T * p, std::size_t n, T value )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_avx2())
+			return __count_avx2(p, n, value);
+		return __count_sse2(p, n, value);
+# else
+		std::size_t	res = 0;
+		for (std::size_t i = 0; i < n; ++i)
+			res += p[i] == value;
+		return res;
+# endif
+	}
+
+	template <class T>
+	void	__replace( T * p, std::size_t n, T old_value, T new_value )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_avx2())
+			return __replace_avx2(p, n, old_value, new_value);
+		return __replace_sse2(p, n, old_value, new_value);
+# else
+		for (std::size_t i = 0; i < n; ++i)
+			if (p[i] == old_value)
+				p[i] = new_value;
+# endif
+	}
+
+	inline void	__minmax( const int * p, std::size_t n, int bias, int & mn, int & mx )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_avx2())
+			return __minmax_avx2(p, n, bias, mn, mx);
+		return __minmax_sse2(p, n, bias, mn, mx);
+# else
+		mn = p[0] ^ bias;
+		mx = mn;
+		for (std::size_t i = 1; i < n; ++i)
+		{
+			int	x = p[i] ^ bias;
+			mn = x < mn ? x : mn;
+			mx = x > mx ? x : mx;
+		}
+		mn ^= bias;
+		mx ^= bias;
+# endif
+	}
+
+	inline unsigned	__sum( const int * p, std::size_t n )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_avx2())
+			return __sum_avx2(p, n);
+		return __sum_sse2(p, n);
+# else
+		unsigned	res = 0;
+		for (std::size_t i = 0; i < n; ++i)
+			res += static_cast<unsigned>(p[i]);
+		return res;
+# endif
+	}
+
+	inline std::size_t	__popcount_words( const uint64_t * p, std::size_t n )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_popcnt())
+			return __popcount_words_popcnt(p, n);
+# endif
+		std::size_t	res = 0;
+		for (std::size_t i = 0; i < n; ++i)
+			res += __builtin_popcountll(p[i]);
+		return res;
+	}
+
+	// dst[i] = dst[i] Op src[i]; Op: 0 and, 1 or, 2 xor
+	template <int Op>
+	void	__bitwise_words( uint64_t * dst, const uint64_t * src, std::size_t n )
+	{
+# if FT_SIMD_X86
+		if (__cpu_has_avx2())
+			return __bitwise_words_avx2<Op>(dst, src, n);
+		return __bitwise_words_sse2<Op>(dst, src, n);
+# else
+		for (std::size_t i = 0; i < n; ++i)
+			dst[i] = Op == 0 ? dst[i] & src[i] : Op == 1 ? dst[i] | src[i] : dst[i] ^ src[i];
+# endif
+	}
+}
+
+} // namespace ft
+
+#endif // FT_SIMD_HPP
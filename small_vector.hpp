@@ -0,0 +1,707 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   small_vector.hpp                                   :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 10:12:40 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 10:12:40 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SMALL_VECTOR_HPP
+# define FT_SMALL_VECTOR_HPP
+
+# include <memory>
+# include <cstddef>
+# include <stdexcept>
+# include "utility.hpp"
+
+namespace ft
+{
+
+// Vector that keeps up to N elements inside the object itself and only
+// allocates from Allocator once it grows past that. Small containers (a
+// stack that rarely gets deep, a short list of children) cost no heap
+// allocation at all. Same interface as ft::vector, but moving or swapping
+// an inline small_vector moves the elements one by one.
+template< class T, std::size_t N, class Allocator = std::allocator<T> >
+class small_vector
+{
+public:
+	typedef T									value_type;
+	typedef Allocator							allocator_type;
+	typedef std::size_t							size_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef value_type&							reference;
+	typedef const value_type&					const_reference;
+	typedef typename Allocator::pointer			pointer;
+	typedef typename Allocator::const_pointer	const_pointer;
+
+	typedef contiguous_iterator<T>						iterator;
+	typedef contiguous_iterator<const T>				const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	static const size_type	inline_capacity = N;
+
+	small_vector() :
+		__data(__inline_data()), __size(0), __capacity(N), __alloc()
+	{}
+
+	explicit small_vector( const Allocator& alloc ) :
+		__data(__inline_data()), __size(0), __capacity(N), __alloc(alloc)
+	{}
+
+	explicit small_vector( size_type count, const T& value = T(),
+						const Allocator& alloc = Allocator() ) :
+		__data(__inline_data()), __size(0), __capacity(N), __alloc(alloc)
+	{
+		if (count > N)
+			__reset_storage(count);
+		try
+		{
+			detail::__uninitialized_fill(__data, count, value);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+		__size = count;
+	}
+
+	template< class InputIt >
+	small_vector( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last, const Allocator& alloc = Allocator() ) :
+		__data(__inline_data()), __size(0), __capacity(N), __alloc(alloc)
+	{
+		try
+		{
+			assign(first, last);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	small_vector( const small_vector& other ) :
+		__data(__inline_data()), __size(0), __capacity(N), __alloc(other.__alloc)
+	{
+		try
+		{
+			assign(other.__data, other.__data + other.__size);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	~small_vector()
+	{
+		detail::__destroy(__data, __data + __size);
+		__release();
+	}
+
+	small_vector& operator=( const small_vector& other )
+	{
+		if (this != &other)
+			assign(other.__data, other.__data + other.__size);
+		return *this;
+	}
+
+# if FT_CXX11
+	small_vector( small_vector&& other )
+		noexcept(std::is_nothrow_move_constructible<T>::value) :
+		__data(__inline_data()), __size(0), __capacity(N), __alloc(other.__alloc)
+	{
+		__steal(other);
+	}
+
+	small_vector& operator=( small_vector&& other )
+	{
+		if (this != &other)
+		{
+			clear();
+			if (!other.__is_inline() and !(__alloc == other.__alloc))
+			{
+				// the heap block can't change owner, move the elements
+				reserve(other.__size);
+				detail::__relocate(other.__data, other.__data + other.__size, __data);
+				__size = other.__size;
+				other.__size = 0;
+				return *this;
+			}
+			__release();
+			__data = __inline_data();
+			__capacity = N;
+			__steal(other);
+		}
+		return *this;
+	}
+# endif
+
+	void assign( size_type count, const T& value )
+	{
+		// value can be an element of *this
+		T	tmp(value);
+		clear();
+		if (count > __capacity)
+			__reset_storage(count);
+		detail::__uninitialized_fill(__data, count, tmp);
+		__size = count;
+	}
+
+	template< class InputIt >
+	void assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{
+		size_type	count = ft::distance(first, last);
+		clear();
+		if (count > __capacity)
+			__reset_storage(count);
+		detail::__uninitialized_copy(first, last, __data);
+		__size = count;
+	}
+
+	allocator_type get_allocator() const
+	{ return __alloc; }
+
+	reference at( size_type pos )
+	{
+		if (pos >= __size)
+			throw std::out_of_range("small_vector");
+		return __data[pos];
+	}
+
+	const_reference at( size_type pos ) const
+	{
+		if (pos >= __size)
+			throw std::out_of_range("small_vector");
+		return __data[pos];
+	}
+
+	reference operator[]( size_type pos )
+	{ return __data[pos]; }
+
+	const_reference operator[]( size_type pos ) const
+	{ return __data[pos]; }
+
+	reference front()
+	{ return __data[0]; }
+
+	const_reference front() const
+	{ return __data[0]; }
+
+	reference back()
+	{ return __data[__size - 1]; }
+
+	const_reference back() const
+	{ return __data[__size - 1]; }
+
+	T* data()
+	{ return __data; }
+
+	const T* data() const
+	{ return __data; }
+
+	iterator begin()
+	{ return iterator(__data); }
+
+	const_iterator begin() const
+	{ return const_iterator(__data); }
+
+	iterator end()
+	{ return iterator(__data + __size); }
+
+	const_iterator end() const
+	{ return const_iterator(__data + __size); }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{ return __alloc.max_size(); }
+
+	size_type capacity() const
+	{ return __capacity; }
+
+	void reserve( size_type new_cap )
+	{
+		// strong exception guarantee
+		if (new_cap <= __capacity)
+			return ;
+		if (new_cap > max_size())
+			throw std::length_error("small_vector");
+		__adopt(__alloc.allocate(new_cap), new_cap, __size, 0);
+	}
+
+	// moves the elements back inside the object when they fit
+	void shrink_to_fit()
+	{
+		if (__is_inline() or __size == __capacity)
+			return ;
+		if (__size > N)
+		{
+			__adopt(__alloc.allocate(__size), __size, __size, 0);
+			return ;
+		}
+		detail::__relocate(__data, __data + __size, __inline_data());
+		__alloc.deallocate(__data, __capacity);
+		__data = __inline_data();
+		__capacity = N;
+	}
+
+	void clear()
+	{
+		detail::__destroy(__data, __data + __size);
+		__size = 0;
+	}
+
+	void push_back( const T& value )
+	{
+		if (__size == __capacity)
+		{
+			// strong exception guarantee, value may live in the old storage
+			size_type	new_cap = __recommend(__size + 1);
+			T			*tmp = __alloc.allocate(new_cap);
+			try
+			{
+				::new (static_cast<void *>(tmp + __size)) T(value);
+			}
+			catch (...)
+			{
+				__alloc.deallocate(tmp, new_cap);
+				throw ;
+			}
+			__adopt(tmp, new_cap, __size, 1);
+		}
+		else
+			::new (static_cast<void *>(__data + __size)) T(value);
+		++__size;
+	}
+
+# if FT_CXX11
+	void push_back( T&& value )
+	{ emplace(end(), std::move(value)); }
+
+	template< class... Args >
+	void emplace_back( Args&&... args )
+	{ emplace(end(), std::forward<Args>(args)...); }
+# endif
+
+	void pop_back()
+	{
+		--__size;
+		detail::__destroy(__data + __size, __data + __size + 1);
+	}
+
+	void resize( size_type count, T value = T() )
+	{
+		if (count < __size)
+		{
+			detail::__destroy(__data + count, __data + __size);
+			__size = count;
+			return ;
+		}
+		if (count > __capacity)
+			reserve(__recommend(count));
+		detail::__uninitialized_fill(__data + __size, count - __size, value);
+		__size = count;
+	}
+
+	// the allocators are not exchanged, they must compare equal
+	void swap( small_vector& other )
+	{
+		if (this == &other)
+			return ;
+		if (!__is_inline() and !other.__is_inline())
+		{
+			ft::swap(__data, other.__data);
+			ft::swap(__capacity, other.__capacity);
+		}
+		else if (!__is_inline() or !other.__is_inline())
+		{
+			small_vector	&heap = __is_inline() ? other : *this;
+			small_vector	&local = __is_inline() ? *this : other;
+			T				*block = heap.__data;
+			size_type		cap = heap.__capacity;
+			detail::__relocate(local.__data, local.__data + local.__size,
+								heap.__inline_data());
+			heap.__data = heap.__inline_data();
+			heap.__capacity = N;
+			local.__data = block;
+			local.__capacity = cap;
+		}
+		else
+		{
+			small_vector	&big = __size < other.__size ? other : *this;
+			small_vector	&little = __size < other.__size ? *this : other;
+			for (size_type i = 0; i < little.__size; ++i)
+				ft::swap(big.__data[i], little.__data[i]);
+			detail::__relocate(big.__data + little.__size, big.__data + big.__size,
+								little.__data + little.__size);
+		}
+		ft::swap(__size, other.__size);
+	}
+
+	iterator insert( iterator pos, const T& value )
+	{
+		size_type	n = pos - begin();
+		insert(pos, 1, value);
+		return iterator(__data + n);
+	}
+
+	void insert( iterator pos, size_type count, const T& value )
+	{
+		size_type	n = pos - begin();
+		if (count == 0)
+			return ;
+		if (__size + count > __capacity)
+		{
+			// strong exception guarantee
+			size_type	new_cap = __recommend(__size + count);
+			T			*tmp = __alloc.allocate(new_cap);
+			try
+			{
+				detail::__uninitialized_fill(tmp + n, count, value);
+			}
+			catch (...)
+			{
+				__alloc.deallocate(tmp, new_cap);
+				throw ;
+			}
+			__adopt(tmp, new_cap, n, count);
+		}
+		else if (n == __size)
+			detail::__uninitialized_fill(__data + n, count, value);
+		else
+		{
+			// basic exception guarantee
+			T	tmp(value);
+			__open_gap(n, count);
+			try
+			{
+				detail::__uninitialized_fill(__data + n, count, tmp);
+			}
+			catch (...)
+			{
+				__drop_around(n, count);
+				throw ;
+			}
+		}
+		__size += count;
+	}
+
+	template< class InputIt >
+	void insert( iterator pos, typename enable_if<is_iterator<InputIt>::value,
+					InputIt>::type first, InputIt last )
+	{
+		size_type	n = pos - begin();
+		size_type	count = ft::distance(first, last);
+		if (count == 0)
+			return ;
+		if (__size + count > __capacity)
+		{
+			// strong exception guarantee
+			size_type	new_cap = __recommend(__size + count);
+			T			*tmp = __alloc.allocate(new_cap);
+			try
+			{
+				detail::__uninitialized_copy(first, last, tmp + n);
+			}
+			catch (...)
+			{
+				__alloc.deallocate(tmp, new_cap);
+				throw ;
+			}
+			__adopt(tmp, new_cap, n, count);
+		}
+		else
+		{
+			// basic exception guarantee
+			__open_gap(n, count);
+			try
+			{
+				detail::__uninitialized_copy(first, last, __data + n);
+			}
+			catch (...)
+			{
+				__drop_around(n, count);
+				throw ;
+			}
+		}
+		__size += count;
+	}
+
+# if FT_CXX11
+	iterator insert( iterator pos, T&& value )
+	{ return emplace(pos, std::move(value)); }
+
+	template< class... Args >
+	iterator emplace( iterator pos, Args&&... args )
+	{
+		size_type	n = pos - begin();
+		if (__size == __capacity)
+		{
+			// strong exception guarantee
+			size_type	new_cap = __recommend(__size + 1);
+			T			*tmp = __alloc.allocate(new_cap);
+			try
+			{
+				::new (static_cast<void *>(tmp + n)) T(std::forward<Args>(args)...);
+			}
+			catch (...)
+			{
+				__alloc.deallocate(tmp, new_cap);
+				throw ;
+			}
+			__adopt(tmp, new_cap, n, 1);
+		}
+		else if (n == __size)
+			::new (static_cast<void *>(__data + n)) T(std::forward<Args>(args)...);
+		else
+		{
+			// basic exception guarantee
+			T	tmp(std::forward<Args>(args)...);
+			__open_gap(n, 1);
+			try
+			{
+				::new (static_cast<void *>(__data + n)) T(std::move(tmp));
+			}
+			catch (...)
+			{
+				__drop_around(n, 1);
+				throw ;
+			}
+		}
+		++__size;
+		return iterator(__data + n);
+	}
+# endif
+
+	iterator erase( iterator pos )
+	{ return erase(pos, pos + 1); }
+
+	iterator erase( iterator first, iterator last )
+	{
+		// basic exception guarantee
+		size_type	n = first - begin();
+		size_type	count = last - first;
+		if (count == 0)
+			return last;
+		detail::__destroy(__data + n, __data + n + count);
+		try
+		{
+			detail::__shift(__data + n + count, __data + __size, __data + n);
+		}
+		catch (...)
+		{
+			detail::__destroy(__data, __data + n);
+			__size = 0;
+			throw ;
+		}
+		__size -= count;
+		return iterator(__data + n);
+	}
+
+private:
+	T *			__inline_data()
+	{ return reinterpret_cast<T *>(__buffer.data); }
+
+	const T *	__inline_data() const
+	{ return reinterpret_cast<const T *>(__buffer.data); }
+
+	bool		__is_inline() const
+	{ return __data == __inline_data(); }
+
+	void		__release()
+	{
+		if (!__is_inline())
+			__alloc.deallocate(__data, __capacity);
+	}
+
+	size_type	__recommend( size_type new_size ) const
+	{
+		if (new_size > max_size())
+			throw std::length_error("small_vector");
+		if (__capacity >= max_size() / 2)
+			return max_size();
+		return ft::max(__capacity * 2, new_size);
+	}
+
+	// replaces the (empty) storage with a heap block of new_cap elements
+	void		__reset_storage( size_type new_cap )
+	{
+		T	*tmp = __alloc.allocate(new_cap);
+		__release();
+		__data = tmp;
+		__capacity = new_cap;
+	}
+
+	// moves the elements into new_data around the already constructed
+	// new_data[pos, pos + gap) and makes it the storage
+	void		__adopt( T * new_data, size_type new_cap, size_type pos, size_type gap )
+	{
+		// strong exception guarantee
+		if (is_trivially_relocatable<T>::value)
+		{
+			detail::__relocate(__data, __data + pos, new_data);
+			detail::__relocate(__data + pos, __data + __size, new_data + pos + gap);
+		}
+		else
+		{
+			bool	head_done = false;
+			try
+			{
+				detail::__uninitialized_move(__data, __data + pos, new_data);
+				head_done = true;
+				detail::__uninitialized_move(__data + pos, __data + __size,
+											new_data + pos + gap);
+			}
+			catch (...)
+			{
+				if (head_done)
+					detail::__destroy(new_data, new_data + pos);
+				detail::__destroy(new_data + pos, new_data + pos + gap);
+				__alloc.deallocate(new_data, new_cap);
+				throw ;
+			}
+			detail::__destroy(__data, __data + __size);
+		}
+		__release();
+		__data = new_data;
+		__capacity = new_cap;
+	}
+
+	// moves [pos, size) up by count, the gap is left unconstructed
+	void		__open_gap( size_type pos, size_type count )
+	{
+		try
+		{
+			detail::__shift(__data + pos, __data + __size, __data + pos + count);
+		}
+		catch (...)
+		{
+			detail::__destroy(__data, __data + pos);
+			__size = 0;
+			throw ;
+		}
+	}
+
+	// filling the gap failed, nothing is left in a usable order
+	void		__drop_around( size_type pos, size_type count )
+	{
+		detail::__destroy(__data, __data + pos);
+		detail::__destroy(__data + pos + count, __data + __size + count);
+		__size = 0;
+	}
+
+# if FT_CXX11
+	// *this is empty and inline
+	void		__steal( small_vector& other )
+	{
+		if (other.__is_inline())
+			detail::__relocate(other.__data, other.__data + other.__size, __data);
+		else
+		{
+			__data = other.__data;
+			__capacity = other.__capacity;
+			other.__data = other.__inline_data();
+			other.__capacity = N;
+		}
+		__size = other.__size;
+		other.__size = 0;
+	}
+# endif
+
+private:
+	aligned_buffer<sizeof(T) * N, alignment_of<T>::value>	__buffer;
+	T *								__data;
+	size_type						__size;
+	size_type						__capacity;
+	Allocator						__alloc;
+};
+
+template< class T, std::size_t N, class Allocator >
+const typename small_vector<T, N, Allocator>::size_type
+	small_vector<T, N, Allocator>::inline_capacity;
+
+template< class T, std::size_t N, class Allocator >
+bool	operator==( const small_vector<T, N, Allocator>& lhs,
+					const small_vector<T, N, Allocator>& rhs )
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template< class T, std::size_t N, class Allocator >
+bool	operator!=( const small_vector<T, N, Allocator>& lhs,
+					const small_vector<T, N, Allocator>& rhs )
+{
+	return !(lhs == rhs);
+}
+
+template< class T, std::size_t N, class Allocator >
+bool	operator<( const small_vector<T, N, Allocator>& lhs,
+					const small_vector<T, N, Allocator>& rhs )
+{
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template< class T, std::size_t N, class Allocator >
+bool	operator<=( const small_vector<T, N, Allocator>& lhs,
+					const small_vector<T, N, Allocator>& rhs )
+{
+	return !(rhs < lhs);
+}
+
+template< class T, std::size_t N, class Allocator >
+bool	operator>( const small_vector<T, N, Allocator>& lhs,
+					const small_vector<T, N, Allocator>& rhs )
+{
+	return rhs < lhs;
+}
+
+template< class T, std::size_t N, class Allocator >
+bool	operator>=( const small_vector<T, N, Allocator>& lhs,
+					const small_vector<T, N, Allocator>& rhs )
+{
+	return !(lhs < rhs);
+}
+
+} // namespace ft
+
+
+namespace std
+{
+	template< class T, std::size_t N, class Allocator >
+	void	swap( ft::small_vector<T, N, Allocator>& lhs,
+				ft::small_vector<T, N, Allocator>& rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // FT_SMALL_VECTOR_HPP
@@ -0,0 +1,716 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   soa_vector.hpp                                     :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 01:18:40 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 01:18:40 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_SOA_VECTOR_HPP
+# define FT_SOA_VECTOR_HPP
+
+# include <new>
+# include <cstddef>
+# include <cstring>
+# include <stdexcept>
+# include "utility.hpp"
+# include "vector.hpp"
+
+// Structure of arrays, C++11 and newer only (variadic templates).
+// soa_vector<Fields...> keeps one contiguous column per field instead of
+// one array of structs, so a pass over one field only loads that field's
+// bytes and column<I>() can go straight to a vectorized loop. All the
+// columns share one allocation and one size / capacity, grown with
+// ft::vector's growth::doubling; each column starts on a 64 byte boundary.
+// operator[] and the iterators give row proxies: row.get<I>() is a
+// reference into column I.
+
+# if FT_CXX11
+#  include <algorithm>
+#  include <tuple>
+#  include <type_traits>
+
+namespace ft
+{
+
+namespace detail
+{
+	// std::index_sequence is C++14
+	template <std::size_t... I>
+	struct __indices
+	{};
+
+	template <std::size_t N, std::size_t... I>
+	struct __make_indices : __make_indices<N - 1, N - 1, I...>
+	{};
+
+	template <std::size_t... I>
+	struct __make_indices<0, I...>
+	{ typedef __indices<I...>	type; };
+}
+
+template <class... Fields>
+class soa_vector
+{
+	static_assert(sizeof...(Fields) != 0, "soa_vector needs at least one field");
+
+	template <std::size_t I>
+	using __at = std::integral_constant<std::size_t, I>;
+
+	typedef __at<sizeof...(Fields)>	__end;
+
+public:
+	typedef std::tuple<Fields...>	value_type;
+	typedef std::size_t				size_type;
+	typedef std::ptrdiff_t			difference_type;
+	typedef growth::doubling		growth_policy;
+
+	template <std::size_t I>
+	using field_type = typename std::tuple_element<I, value_type>::type;
+
+	static const size_type	fields = sizeof...(Fields);
+	static const size_type	column_alignment = 64;
+
+	// row i of a soa_vector, a view: get<I>() is the element of column I
+	template <bool Const>
+	class basic_row
+	{
+		typedef typename conditional<Const, const soa_vector, soa_vector>::type	__owner;
+	public:
+		template <std::size_t I>
+		using field_reference = typename conditional<Const,
+									const field_type<I> &, field_type<I> &>::type;
+
+		basic_row( __owner * v, size_type i ) : __vector(v), __index(i) {}
+
+		template <std::size_t I>
+		field_reference<I>	get() const
+		{ return __vector->template column<I>()[__index]; }
+
+		// copy of the row
+		operator value_type() const
+		{ return __value(typename detail::__make_indices<sizeof...(Fields)>::type()); }
+
+		// assigns every field, for rows that are not Const
+		basic_row &	operator=( const value_type & value )
+		{
+			__assign(value, __at<0>());
+			return *this;
+		}
+
+		basic_row &	operator=( const basic_row & other )
+		{
+			if (other.__vector != __vector or other.__index != __index)
+				__assign(value_type(other), __at<0>());
+			return *this;
+		}
+
+		size_type	index() const
+		{ return __index; }
+
+	private:
+		template <std::size_t... I>
+		value_type	__value( detail::__indices<I...> ) const
+		{ return value_type(get<I>()...); }
+
+		template <std::size_t I>
+		void	__assign( const value_type & value, __at<I> )
+		{
+			get<I>() = std::get<I>(value);
+			__assign(value, __at<I + 1>());
+		}
+
+		void	__assign( const value_type &, __end )
+		{}
+
+		__owner		*__vector;
+		size_type	__index;
+	};
+
+	typedef basic_row<false>	reference;
+	typedef basic_row<true>		const_reference;
+
+	// random access iterator over the rows, dereferences to a proxy
+	template <bool Const>
+	class basic_iterator :
+		public ft::iterator<std::random_access_iterator_tag, value_type,
+							difference_type, void, basic_row<Const> >
+	{
+		typedef typename conditional<Const, const soa_vector, soa_vector>::type	__owner;
+	public:
+		typedef basic_row<Const>	reference;
+
+		basic_iterator() : __vector(NULL), __index(0) {}
+		basic_iterator( __owner * v, size_type i ) : __vector(v), __index(i) {}
+		basic_iterator( const basic_iterator<false> & other ) :
+			__vector(other.__base()), __index(other.index()) {}
+
+		__owner *	__base() const {
+			return __vector;
+		}
+		size_type	index() const {
+			return __index;
+		}
+		reference	operator*() const {
+			return reference(__vector, __index);
+		}
+		reference	operator[]( difference_type n ) const {
+			return reference(__vector, __index + n);
+		}
+		basic_iterator &	operator++() {
+			++__index;
+			return *this;
+		}
+		basic_iterator	operator++(int) {
+			basic_iterator tmp(*this);
+			++__index;
+			return tmp;
+		}
+		basic_iterator &	operator--() {
+			--__index;
+			return *this;
+		}
+		basic_iterator	operator--(int) {
+			basic_iterator tmp(*this);
+			--__index;
+			return tmp;
+		}
+		basic_iterator &	operator+=( difference_type n ) {
+			__index += n;
+			return *this;
+		}
+		basic_iterator &	operator-=( difference_type n ) {
+			__index -= n;
+			return *this;
+		}
+		basic_iterator	operator+( difference_type n ) const {
+			return basic_iterator(__vector, __index + n);
+		}
+		basic_iterator	operator-( difference_type n ) const {
+			return basic_iterator(__vector, __index - n);
+		}
+
+		friend basic_iterator	operator+( difference_type n, basic_iterator it )
+		{ return it + n; }
+		friend difference_type	operator-( basic_iterator lhs, basic_iterator rhs )
+		{ return lhs.__index - rhs.__index; }
+		friend bool operator==( basic_iterator lhs, basic_iterator rhs )
+		{ return lhs.__index == rhs.__index; }
+		friend bool operator!=( basic_iterator lhs, basic_iterator rhs )
+		{ return lhs.__index != rhs.__index; }
+		friend bool operator<( basic_iterator lhs, basic_iterator rhs )
+		{ return lhs.__index < rhs.__index; }
+		friend bool operator>( basic_iterator lhs, basic_iterator rhs )
+		{ return lhs.__index > rhs.__index; }
+		friend bool operator<=( basic_iterator lhs, basic_iterator rhs )
+		{ return lhs.__index <= rhs.__index; }
+		friend bool operator>=( basic_iterator lhs, basic_iterator rhs )
+		{ return lhs.__index >= rhs.__index; }
+
+	private:
+		__owner		*__vector;
+		size_type	__index;
+	};
+
+	typedef basic_iterator<false>					iterator;
+	typedef basic_iterator<true>					const_iterator;
+	typedef ft::reverse_iterator<iterator>			reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+
+	soa_vector() :
+		__columns(), __size(0), __capacity(0), __block(NULL)
+	{}
+
+	explicit soa_vector( size_type count ) :
+		__columns(), __size(0), __capacity(0), __block(NULL)
+	{
+		try
+		{
+			resize(count);
+		}
+		catch (...)
+		{
+			::operator delete(__block);
+			throw ;
+		}
+	}
+
+	soa_vector( const soa_vector & other ) :
+		__columns(), __size(0), __capacity(0), __block(NULL)
+	{
+		if (other.__size == 0)
+			return ;
+		__block = __allocate(other.__size, __columns);
+		__capacity = other.__size;
+		try
+		{
+			__copy_columns(other, __at<0>());
+		}
+		catch (...)
+		{
+			::operator delete(__block);
+			throw ;
+		}
+		__size = other.__size;
+	}
+
+	soa_vector( soa_vector && other ) noexcept :
+		__columns(other.__columns), __size(other.__size), __capacity(other.__capacity),
+		__block(other.__block)
+	{ other.__forget(); }
+
+	~soa_vector()
+	{
+		clear();
+		::operator delete(__block);
+	}
+
+	soa_vector &	operator=( const soa_vector & other )
+	{
+		if (this != &other)
+		{
+			soa_vector	tmp(other);
+			swap(tmp);
+		}
+		return *this;
+	}
+
+	soa_vector &	operator=( soa_vector && other )
+	{
+		if (this != &other)
+		{
+			clear();
+			::operator delete(__block);
+			__columns = other.__columns;
+			__size = other.__size;
+			__capacity = other.__capacity;
+			__block = other.__block;
+			other.__forget();
+		}
+		return *this;
+	}
+
+	// contiguous column of field I, size() elements, aligned to
+	// column_alignment
+	template <std::size_t I>
+	field_type<I> *	column()
+	{ return std::get<I>(__columns); }
+
+	template <std::size_t I>
+	const field_type<I> *	column() const
+	{ return std::get<I>(__columns); }
+
+	template <std::size_t I>
+	field_type<I> &	get( size_type row )
+	{ return std::get<I>(__columns)[row]; }
+
+	template <std::size_t I>
+	const field_type<I> &	get( size_type row ) const
+	{ return std::get<I>(__columns)[row]; }
+
+	reference	operator[]( size_type row )
+	{ return reference(this, row); }
+
+	const_reference	operator[]( size_type row ) const
+	{ return const_reference(this, row); }
+
+	reference	at( size_type row )
+	{
+		if (row >= __size)
+			throw std::out_of_range("soa_vector");
+		return reference(this, row);
+	}
+
+	const_reference	at( size_type row ) const
+	{
+		if (row >= __size)
+			throw std::out_of_range("soa_vector");
+		return const_reference(this, row);
+	}
+
+	reference	front()
+	{ return reference(this, 0); }
+
+	const_reference	front() const
+	{ return const_reference(this, 0); }
+
+	reference	back()
+	{ return reference(this, __size - 1); }
+
+	const_reference	back() const
+	{ return const_reference(this, __size - 1); }
+
+	iterator	begin()
+	{ return iterator(this, 0); }
+
+	const_iterator	begin() const
+	{ return const_iterator(this, 0); }
+
+	iterator	end()
+	{ return iterator(this, __size); }
+
+	const_iterator	end() const
+	{ return const_iterator(this, __size); }
+
+	reverse_iterator	rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator	rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator	rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator	rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool	empty() const
+	{ return __size == 0; }
+
+	size_type	size() const
+	{ return __size; }
+
+	size_type	capacity() const
+	{ return __capacity; }
+
+	size_type	max_size() const
+	{ return static_cast<size_type>(-1) / 2 / __row_bytes(); }
+
+	void	reserve( size_type new_cap )
+	{
+		if (new_cap > max_size())
+			throw std::length_error("soa_vector");
+		if (new_cap > __capacity)
+			__reallocate(new_cap);
+	}
+
+	void	shrink_to_fit()
+	{
+		if (__capacity == __size)
+			return ;
+		if (__size != 0)
+			__reallocate(__size);
+		else
+		{
+			::operator delete(__block);
+			__forget();
+		}
+	}
+
+	void	clear()
+	{
+		__destroy_columns(0, __size, __at<0>());
+		__size = 0;
+	}
+
+	// one value per field
+	template <class... Args>
+	void	emplace_back( Args&&... args )
+	{
+		static_assert(sizeof...(Args) == sizeof...(Fields), "one value per field");
+		if (__size == __capacity)
+			__reallocate(__recommend(__size + 1));
+		__construct_row(__size, std::forward_as_tuple(std::forward<Args>(args)...), __at<0>());
+		++__size;
+	}
+
+	void	push_back( const value_type & value )
+	{
+		if (__size == __capacity)
+			__reallocate(__recommend(__size + 1));
+		__construct_row(__size, value, __at<0>());
+		++__size;
+	}
+
+	void	push_back( value_type && value )
+	{
+		if (__size == __capacity)
+			__reallocate(__recommend(__size + 1));
+		__construct_row(__size, std::move(value), __at<0>());
+		++__size;
+	}
+
+	void	pop_back()
+	{
+		--__size;
+		__destroy_columns(__size, __size + 1, __at<0>());
+	}
+
+	// new rows are value-initialized
+	void	resize( size_type count )
+	{
+		if (count <= __size)
+		{
+			__destroy_columns(count, __size, __at<0>());
+			__size = count;
+			return ;
+		}
+		if (count > __capacity)
+			__reallocate(ft::max(count, __recommend(count)));
+		for (; __size != count; ++__size)
+			__construct_row(__size, std::tuple<>(), __at<0>());
+	}
+
+	// keeps the order, O(size() - pos)
+	iterator	erase( const_iterator pos )
+	{
+		size_type	row = pos.index();
+		__shift_columns(row, __at<0>());
+		--__size;
+		return iterator(this, row);
+	}
+
+	// O(1): the last row takes the place of the erased one
+	void	swap_remove( size_type row )
+	{
+		if (row != __size - 1)
+			__move_row(__size - 1, row, __at<0>());
+		pop_back();
+	}
+
+	void	swap( soa_vector & other )
+	{
+		std::swap(__columns, other.__columns);
+		ft::swap(__size, other.__size);
+		ft::swap(__capacity, other.__capacity);
+		ft::swap(__block, other.__block);
+	}
+
+private:
+	typedef std::tuple<Fields *...>	__column_pointers;
+
+	static size_type	__column_bytes( size_type bytes )
+	{ return (bytes + column_alignment - 1) & ~(column_alignment - 1); }
+
+	static size_type	__row_bytes()
+	{ return __row_bytes(__at<0>()); }
+
+	template <std::size_t I>
+	static size_type	__row_bytes( __at<I> )
+	{ return sizeof(field_type<I>) + __row_bytes(__at<I + 1>()); }
+
+	static size_type	__row_bytes( __end )
+	{ return 0; }
+
+	size_type	__recommend( size_type required ) const
+	{
+		if (required > max_size())
+			throw std::length_error("soa_vector");
+		return ft::min(growth_policy::next(__capacity, required, __row_bytes()), max_size());
+	}
+
+	void	__forget()
+	{
+		__columns = __column_pointers();
+		__size = 0;
+		__capacity = 0;
+		__block = NULL;
+	}
+
+	// one block for all the columns, the pointers go to columns
+	static void *	__allocate( size_type capacity, __column_pointers & columns )
+	{
+		size_type	bytes = __layout(capacity, NULL, columns, __at<0>());
+		void		*block = ::operator new(bytes + column_alignment - 1);
+		char		*base = reinterpret_cast<char *>(
+							(reinterpret_cast<std::size_t>(block) + column_alignment - 1)
+							& ~(column_alignment - 1));
+		__layout(capacity, base, columns, __at<0>());
+		return block;
+	}
+
+	// total size of the columns; places them from base when it is not NULL
+	template <std::size_t I>
+	static size_type	__layout( size_type capacity, char * base,
+								__column_pointers & columns, __at<I> )
+	{
+		size_type	bytes = __column_bytes(capacity * sizeof(field_type<I>));
+		if (base != NULL)
+			std::get<I>(columns) = reinterpret_cast<field_type<I> *>(base);
+		return bytes + __layout(capacity, base ? base + bytes : NULL, columns, __at<I + 1>());
+	}
+
+	static size_type	__layout( size_type, char *, __column_pointers &, __end )
+	{ return 0; }
+
+	// strong guarantee: the old columns stay intact until every new one
+	// is complete
+	void	__reallocate( size_type new_cap )
+	{
+		__column_pointers	columns;
+		void				*block = __allocate(new_cap, columns);
+		try
+		{
+			__move_columns(columns, __at<0>());
+		}
+		catch (...)
+		{
+			::operator delete(block);
+			throw ;
+		}
+		__release_columns(__at<0>());
+		::operator delete(__block);
+		__columns = columns;
+		__capacity = new_cap;
+		__block = block;
+	}
+
+	template <std::size_t I>
+	void	__move_columns( __column_pointers & columns, __at<I> )
+	{
+		typedef field_type<I>	T;
+		T	*src = std::get<I>(__columns);
+		T	*dest = std::get<I>(columns);
+		if (is_trivially_relocatable<T>::value)
+		{
+			if (__size != 0)
+				std::memcpy(static_cast<void *>(dest), src, __size * sizeof(T));
+			__move_columns(columns, __at<I + 1>());
+			return ;
+		}
+		detail::__uninitialized_move(src, src + __size, dest);
+		try
+		{
+			__move_columns(columns, __at<I + 1>());
+		}
+		catch (...)
+		{
+			detail::__destroy(dest, dest + __size);
+			throw ;
+		}
+	}
+
+	void	__move_columns( __column_pointers &, __end )
+	{}
+
+	// ends the old columns once they have been moved out
+	template <std::size_t I>
+	void	__release_columns( __at<I> )
+	{
+		typedef field_type<I>	T;
+		if (not is_trivially_relocatable<T>::value)
+			detail::__destroy(std::get<I>(__columns), std::get<I>(__columns) + __size);
+		__release_columns(__at<I + 1>());
+	}
+
+	void	__release_columns( __end )
+	{}
+
+	template <std::size_t I>
+	void	__copy_columns( const soa_vector & other, __at<I> )
+	{
+		typedef field_type<I>	T;
+		const T	*src = std::get<I>(other.__columns);
+		T		*dest = std::get<I>(__columns);
+		detail::__uninitialized_copy(src, src + other.__size, dest);
+		try
+		{
+			__copy_columns(other, __at<I + 1>());
+		}
+		catch (...)
+		{
+			detail::__destroy(dest, dest + other.__size);
+			throw ;
+		}
+	}
+
+	void	__copy_columns( const soa_vector &, __end )
+	{}
+
+	template <std::size_t I>
+	void	__destroy_columns( size_type first, size_type last, __at<I> )
+	{
+		detail::__destroy(std::get<I>(__columns) + first, std::get<I>(__columns) + last);
+		__destroy_columns(first, last, __at<I + 1>());
+	}
+
+	void	__destroy_columns( size_type, size_type, __end )
+	{}
+
+	// builds field I of row from element I of values, or value-initializes
+	// it when values has fewer elements; all or nothing
+	template <class Tuple, std::size_t I>
+	void	__construct_row( size_type row, Tuple && values, __at<I> )
+	{
+		typedef field_type<I>	T;
+		T	*slot = std::get<I>(__columns) + row;
+		__construct_field(slot, std::forward<Tuple>(values), __at<I>(),
+				std::integral_constant<bool, (I < std::tuple_size<
+									typename std::decay<Tuple>::type>::value)>());
+		try
+		{
+			__construct_row(row, std::forward<Tuple>(values), __at<I + 1>());
+		}
+		catch (...)
+		{
+			slot->~T();
+			throw ;
+		}
+	}
+
+	template <class Tuple>
+	void	__construct_row( size_type, Tuple &&, __end )
+	{}
+
+	template <class T, class Tuple, std::size_t I>
+	static void	__construct_field( T * slot, Tuple && values, __at<I>, std::true_type )
+	{ ::new (static_cast<void *>(slot)) T(std::get<I>(std::forward<Tuple>(values))); }
+
+	template <class T, class Tuple, std::size_t I>
+	static void	__construct_field( T * slot, Tuple &&, __at<I>, std::false_type )
+	{ ::new (static_cast<void *>(slot)) T(); }
+
+	// moves the rows after row one step down, the last one is destroyed
+	template <std::size_t I>
+	void	__shift_columns( size_type row, __at<I> )
+	{
+		typedef field_type<I>	T;
+		T	*col = std::get<I>(__columns);
+		std::move(col + row + 1, col + __size, col + row);
+		col[__size - 1].~T();
+		__shift_columns(row, __at<I + 1>());
+	}
+
+	void	__shift_columns( size_type, __end )
+	{}
+
+	template <std::size_t I>
+	void	__move_row( size_type from, size_type to, __at<I> )
+	{
+		std::get<I>(__columns)[to] = std::move(std::get<I>(__columns)[from]);
+		__move_row(from, to, __at<I + 1>());
+	}
+
+	void	__move_row( size_type, size_type, __end )
+	{}
+
+private:
+	__column_pointers	__columns;
+	size_type			__size;
+	size_type			__capacity;
+	void				*__block;
+};
+
+template <class... Fields>
+const typename soa_vector<Fields...>::size_type	soa_vector<Fields...>::fields;
+template <class... Fields>
+const typename soa_vector<Fields...>::size_type	soa_vector<Fields...>::column_alignment;
+
+} // namespace ft
+
+namespace std
+{
+	template <class... Fields>
+	void	swap( ft::soa_vector<Fields...> & lhs, ft::soa_vector<Fields...> & rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+# endif // FT_CXX11
+
+#endif // FT_SOA_VECTOR_HPP
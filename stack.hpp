@@ -14,12 +14,29 @@
 # define FT_STACK_HPP
 
 #include "vector.hpp"
+#include "deque.hpp"
 #include "utility.hpp"
 
 namespace ft
 {
 
-template< class T, class Container = ft::vector<T> >
+namespace detail
+{
+	// ft::deque never moves its elements as it grows, so push() has no
+	// reallocation spikes on deep stacks. Use stack<T, ft::deque<T> >, or
+	// define FT_STACK_USE_DEQUE to make it the default container.
+	template <class T>
+	struct __stack_container
+	{
+# ifdef FT_STACK_USE_DEQUE
+		typedef ft::deque<T>	type;
+# else
+		typedef ft::vector<T>	type;
+# endif
+	};
+}
+
+template< class T, class Container = typename detail::__stack_container<T>::type >
 class stack
 {
 protected:
@@ -42,6 +59,19 @@ public:
 		return *this;
 	}
 
+# if FT_CXX11
+	explicit stack( Container&& cont ) :
+		__container(std::move(cont)) {};
+
+	stack( stack&& other ) : __container(std::move(other.__container)) {};
+
+	stack& operator=( stack&& other )
+	{
+		__container = std::move(other.__container);
+		return *this;
+	}
+# endif
+
 	reference top()
 	{ return __container.back(); }
 	
@@ -56,6 +86,15 @@ public:
 	
 	void push( const value_type& value )
 	{ return __container.push_back(value); }
+
+# if FT_CXX11
+	void push( value_type&& value )
+	{ __container.push_back(std::move(value)); }
+
+	template< class... Args >
+	void emplace( Args&&... args )
+	{ __container.emplace_back(std::forward<Args>(args)...); }
+# endif
 	
 	void pop()
 	{ __container.pop_back(); }
@@ -0,0 +1,490 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   static_vector.hpp                                  :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 11:04:17 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 11:04:17 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_STATIC_VECTOR_HPP
+# define FT_STATIC_VECTOR_HPP
+
+# include <cstddef>
+# include <stdexcept>
+# include "utility.hpp"
+
+namespace ft
+{
+
+// What static_vector does when an operation needs more than N elements.
+// check() gets the size the operation needs.
+namespace overflow
+{
+	struct checked
+	{
+		static void	check( std::size_t required, std::size_t capacity )
+		{
+			if (required > capacity)
+				throw std::length_error("static_vector");
+		}
+	};
+
+	// no test at all, overflowing is undefined behaviour
+	struct unchecked
+	{
+		static void	check( std::size_t, std::size_t )
+		{}
+	};
+}
+
+
+// Vector with room for N elements inside the object. It never allocates,
+// so it can be used where calling the allocator isn't allowed. Has the
+// interface of ft::vector, capacity() is always N.
+template< class T, std::size_t N, class Overflow = overflow::checked >
+class static_vector
+{
+public:
+	typedef T									value_type;
+	typedef Overflow							overflow_policy;
+	typedef std::size_t							size_type;
+	typedef std::ptrdiff_t						difference_type;
+	typedef value_type&							reference;
+	typedef const value_type&					const_reference;
+	typedef T *									pointer;
+	typedef const T *							const_pointer;
+
+	typedef contiguous_iterator<T>						iterator;
+	typedef contiguous_iterator<const T>				const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	static_vector() : __size(0)
+	{}
+
+	explicit static_vector( size_type count, const T& value = T() ) : __size(0)
+	{
+		Overflow::check(count, N);
+		detail::__uninitialized_fill(__data(), count, value);
+		__size = count;
+	}
+
+	template< class InputIt >
+	static_vector( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last ) : __size(0)
+	{
+		assign(first, last);
+	}
+
+	static_vector( const static_vector& other ) : __size(0)
+	{
+		detail::__uninitialized_copy(other.__data(), other.__data() + other.__size, __data());
+		__size = other.__size;
+	}
+
+	~static_vector()
+	{
+		clear();
+	}
+
+	static_vector& operator=( const static_vector& other )
+	{
+		if (this != &other)
+			assign(other.__data(), other.__data() + other.__size);
+		return *this;
+	}
+
+# if FT_CXX11
+	static_vector( static_vector&& other )
+		noexcept(std::is_nothrow_move_constructible<T>::value) : __size(0)
+	{
+		detail::__relocate(other.__data(), other.__data() + other.__size, __data());
+		__size = other.__size;
+		other.__size = 0;
+	}
+
+	static_vector& operator=( static_vector&& other )
+	{
+		if (this != &other)
+		{
+			clear();
+			detail::__relocate(other.__data(), other.__data() + other.__size, __data());
+			__size = other.__size;
+			other.__size = 0;
+		}
+		return *this;
+	}
+# endif
+
+	void assign( size_type count, const T& value )
+	{
+		Overflow::check(count, N);
+		// value can be an element of *this
+		T	tmp(value);
+		clear();
+		detail::__uninitialized_fill(__data(), count, tmp);
+		__size = count;
+	}
+
+	template< class InputIt >
+	void assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{
+		size_type	count = ft::distance(first, last);
+		Overflow::check(count, N);
+		clear();
+		detail::__uninitialized_copy(first, last, __data());
+		__size = count;
+	}
+
+	reference at( size_type pos )
+	{
+		if (pos >= __size)
+			throw std::out_of_range("static_vector");
+		return __data()[pos];
+	}
+
+	const_reference at( size_type pos ) const
+	{
+		if (pos >= __size)
+			throw std::out_of_range("static_vector");
+		return __data()[pos];
+	}
+
+	reference operator[]( size_type pos )
+	{ return __data()[pos]; }
+
+	const_reference operator[]( size_type pos ) const
+	{ return __data()[pos]; }
+
+	reference front()
+	{ return __data()[0]; }
+
+	const_reference front() const
+	{ return __data()[0]; }
+
+	reference back()
+	{ return __data()[__size - 1]; }
+
+	const_reference back() const
+	{ return __data()[__size - 1]; }
+
+	T* data()
+	{ return __data(); }
+
+	const T* data() const
+	{ return __data(); }
+
+	iterator begin()
+	{ return iterator(__data()); }
+
+	const_iterator begin() const
+	{ return const_iterator(__data()); }
+
+	iterator end()
+	{ return iterator(__data() + __size); }
+
+	const_iterator end() const
+	{ return const_iterator(__data() + __size); }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	bool full() const
+	{ return __size == N; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{ return N; }
+
+	size_type capacity() const
+	{ return N; }
+
+	void reserve( size_type new_cap )
+	{ Overflow::check(new_cap, N); }
+
+	void shrink_to_fit()
+	{}
+
+	void clear()
+	{
+		detail::__destroy(__data(), __data() + __size);
+		__size = 0;
+	}
+
+	void push_back( const T& value )
+	{
+		Overflow::check(__size + 1, N);
+		::new (static_cast<void *>(__data() + __size)) T(value);
+		++__size;
+	}
+
+# if FT_CXX11
+	void push_back( T&& value )
+	{ emplace_back(std::move(value)); }
+
+	template< class... Args >
+	void emplace_back( Args&&... args )
+	{
+		Overflow::check(__size + 1, N);
+		::new (static_cast<void *>(__data() + __size)) T(std::forward<Args>(args)...);
+		++__size;
+	}
+# endif
+
+	void pop_back()
+	{
+		--__size;
+		detail::__destroy(__data() + __size, __data() + __size + 1);
+	}
+
+	void resize( size_type count, T value = T() )
+	{
+		if (count < __size)
+		{
+			detail::__destroy(__data() + count, __data() + __size);
+			__size = count;
+			return ;
+		}
+		Overflow::check(count, N);
+		detail::__uninitialized_fill(__data() + __size, count - __size, value);
+		__size = count;
+	}
+
+	// swaps element by element, linear in size()
+	void swap( static_vector& other )
+	{
+		if (this == &other)
+			return ;
+		static_vector	&big = __size < other.__size ? other : *this;
+		static_vector	&little = __size < other.__size ? *this : other;
+		for (size_type i = 0; i < little.__size; ++i)
+			ft::swap(big.__data()[i], little.__data()[i]);
+		detail::__relocate(big.__data() + little.__size, big.__data() + big.__size,
+							little.__data() + little.__size);
+		ft::swap(__size, other.__size);
+	}
+
+	iterator insert( iterator pos, const T& value )
+	{
+		size_type	n = pos - begin();
+		insert(pos, 1, value);
+		return iterator(__data() + n);
+	}
+
+	void insert( iterator pos, size_type count, const T& value )
+	{
+		size_type	n = pos - begin();
+		if (count == 0)
+			return ;
+		Overflow::check(__size + count, N);
+		if (n == __size)
+			detail::__uninitialized_fill(__data() + n, count, value);
+		else
+		{
+			// basic exception guarantee
+			T	tmp(value);
+			__open_gap(n, count);
+			try
+			{
+				detail::__uninitialized_fill(__data() + n, count, tmp);
+			}
+			catch (...)
+			{
+				__drop_around(n, count);
+				throw ;
+			}
+		}
+		__size += count;
+	}
+
+	template< class InputIt >
+	void insert( iterator pos, typename enable_if<is_iterator<InputIt>::value,
+					InputIt>::type first, InputIt last )
+	{
+		size_type	n = pos - begin();
+		size_type	count = ft::distance(first, last);
+		if (count == 0)
+			return ;
+		Overflow::check(__size + count, N);
+		// basic exception guarantee
+		__open_gap(n, count);
+		try
+		{
+			detail::__uninitialized_copy(first, last, __data() + n);
+		}
+		catch (...)
+		{
+			__drop_around(n, count);
+			throw ;
+		}
+		__size += count;
+	}
+
+# if FT_CXX11
+	iterator insert( iterator pos, T&& value )
+	{ return emplace(pos, std::move(value)); }
+
+	template< class... Args >
+	iterator emplace( iterator pos, Args&&... args )
+	{
+		size_type	n = pos - begin();
+		Overflow::check(__size + 1, N);
+		if (n == __size)
+			::new (static_cast<void *>(__data() + n)) T(std::forward<Args>(args)...);
+		else
+		{
+			// basic exception guarantee
+			T	tmp(std::forward<Args>(args)...);
+			__open_gap(n, 1);
+			try
+			{
+				::new (static_cast<void *>(__data() + n)) T(std::move(tmp));
+			}
+			catch (...)
+			{
+				__drop_around(n, 1);
+				throw ;
+			}
+		}
+		++__size;
+		return iterator(__data() + n);
+	}
+# endif
+
+	iterator erase( iterator pos )
+	{ return erase(pos, pos + 1); }
+
+	iterator erase( iterator first, iterator last )
+	{
+		// basic exception guarantee
+		size_type	n = first - begin();
+		size_type	count = last - first;
+		if (count == 0)
+			return last;
+		detail::__destroy(__data() + n, __data() + n + count);
+		try
+		{
+			detail::__shift(__data() + n + count, __data() + __size, __data() + n);
+		}
+		catch (...)
+		{
+			detail::__destroy(__data(), __data() + n);
+			__size = 0;
+			throw ;
+		}
+		__size -= count;
+		return iterator(__data() + n);
+	}
+
+private:
+	T *			__data()
+	{ return reinterpret_cast<T *>(__buffer.data); }
+
+	const T *	__data() const
+	{ return reinterpret_cast<const T *>(__buffer.data); }
+
+	// moves [pos, size) up by count, the gap is left unconstructed
+	void		__open_gap( size_type pos, size_type count )
+	{
+		try
+		{
+			detail::__shift(__data() + pos, __data() + __size, __data() + pos + count);
+		}
+		catch (...)
+		{
+			detail::__destroy(__data(), __data() + pos);
+			__size = 0;
+			throw ;
+		}
+	}
+
+	// filling the gap failed, nothing is left in a usable order
+	void		__drop_around( size_type pos, size_type count )
+	{
+		detail::__destroy(__data(), __data() + pos);
+		detail::__destroy(__data() + pos + count, __data() + __size + count);
+		__size = 0;
+	}
+
+private:
+	aligned_buffer<sizeof(T) * N, alignment_of<T>::value>	__buffer;
+	size_type						__size;
+};
+
+template< class T, std::size_t N, class Overflow >
+bool	operator==( const static_vector<T, N, Overflow>& lhs,
+					const static_vector<T, N, Overflow>& rhs )
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template< class T, std::size_t N, class Overflow >
+bool	operator!=( const static_vector<T, N, Overflow>& lhs,
+					const static_vector<T, N, Overflow>& rhs )
+{
+	return !(lhs == rhs);
+}
+
+template< class T, std::size_t N, class Overflow >
+bool	operator<( const static_vector<T, N, Overflow>& lhs,
+					const static_vector<T, N, Overflow>& rhs )
+{
+	return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template< class T, std::size_t N, class Overflow >
+bool	operator<=( const static_vector<T, N, Overflow>& lhs,
+					const static_vector<T, N, Overflow>& rhs )
+{
+	return !(rhs < lhs);
+}
+
+template< class T, std::size_t N, class Overflow >
+bool	operator>( const static_vector<T, N, Overflow>& lhs,
+					const static_vector<T, N, Overflow>& rhs )
+{
+	return rhs < lhs;
+}
+
+template< class T, std::size_t N, class Overflow >
+bool	operator>=( const static_vector<T, N, Overflow>& lhs,
+					const static_vector<T, N, Overflow>& rhs )
+{
+	return !(lhs < rhs);
+}
+
+} // namespace ft
+
+
+namespace std
+{
+	template< class T, std::size_t N, class Overflow >
+	void	swap( ft::static_vector<T, N, Overflow>& lhs,
+				ft::static_vector<T, N, Overflow>& rhs )
+	{
+		lhs.swap(rhs);
+	}
+}
+
+#endif // FT_STATIC_VECTOR_HPP
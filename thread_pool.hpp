@@ -0,0 +1,459 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   thread_pool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/19 21:12:40 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/19 21:12:40 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_THREAD_POOL_HPP
+# define FT_THREAD_POOL_HPP
+
+# include <new>
+# include <cstddef>
+# include <stdexcept>
+# include <string>
+# include <pthread.h>
+# include <sched.h>
+# include <unistd.h>
+# include "utility.hpp"
+# if FT_CXX11
+#  include <exception>
+# endif
+
+// Fork-join thread pool.
+// Every worker owns a deque of tasks: it pushes and pops at the back, so
+// it keeps working on the most recent (smallest, cache-hot) pieces, and
+// idle workers steal from the front of the others, where the oldest and
+// biggest pieces are. Tasks spawned from outside the pool go to a shared
+// injection deque that the workers steal from.
+// A thread that waits on a task_group runs queued tasks in the meantime,
+// so tasks may spawn and wait on nested groups without deadlocking.
+
+namespace ft
+{
+
+class thread_pool;
+class task_group;
+
+namespace detail
+{
+	struct __mutex_guard
+	{
+		pthread_mutex_t	&m;
+		explicit __mutex_guard( pthread_mutex_t & m ) : m(m)
+		{ pthread_mutex_lock(&m); }
+		~__mutex_guard()
+		{ pthread_mutex_unlock(&m); }
+	};
+
+	inline std::size_t	__hardware_threads()
+	{
+		long	n = sysconf(_SC_NPROCESSORS_ONLN);
+		return n > 0 ? n : 1;
+	}
+
+	// hot fields written by different threads are kept this far apart
+	static const std::size_t	__cache_line = 64;
+
+	// body of a spin loop: lets the sibling hyperthread run and saves
+	// power while waiting on another core
+	inline void	__cpu_relax()
+	{
+# if defined(__i386__) || defined(__x86_64__)
+		__builtin_ia32_pause();
+# elif defined(__aarch64__)
+		__asm__ __volatile__("yield");
+# endif
+	}
+
+	// tasks still running in a group and the first exception one of them
+	// threw
+	struct __group_state
+	{
+		long			pending;
+		bool			failed;
+# if FT_CXX11
+		std::exception_ptr	error;
+# else
+		std::string		error;
+# endif
+
+		__group_state() : pending(0), failed(false) {}
+
+		bool	done() const
+		{ return __atomic_load_n(&pending, __ATOMIC_ACQUIRE) == 0; }
+
+		// rethrows in the waiting thread once every task has finished
+		void	rethrow()
+		{
+			if (not failed)
+				return ;
+			failed = false;
+# if FT_CXX11
+			std::exception_ptr	e = error;
+			error = std::exception_ptr();
+			std::rethrow_exception(e);
+# else
+			std::string	e;
+			e.swap(error);
+			throw std::runtime_error(e);
+# endif
+		}
+	};
+
+	struct __task
+	{
+		__group_state	*group;
+
+		__task() : group(0) {}
+		virtual ~__task() {}
+		virtual void	run() = 0;
+	};
+
+	template <class F>
+	struct __task_impl : __task
+	{
+		F	f;
+
+		explicit __task_impl( const F & f ) : f(f) {}
+
+		void	run()
+		{ f(); }
+	};
+
+	// circular buffer of tasks behind a mutex, the owner works at the back
+	// and thieves at the front
+	class __work_deque
+	{
+	public:
+		__work_deque() : __tasks(0), __head(0), __size(0), __capacity(0)
+		{ pthread_mutex_init(&__mutex, NULL); }
+
+		~__work_deque()
+		{
+			delete[] __tasks;
+			pthread_mutex_destroy(&__mutex);
+		}
+
+		void	push_back( __task * task )
+		{
+			__mutex_guard	lock(__mutex);
+			if (__size == __capacity)
+				__grow();
+			__tasks[(__head + __size) & (__capacity - 1)] = task;
+			++__size;
+		}
+
+		__task *	pop_back()
+		{
+			__mutex_guard	lock(__mutex);
+			if (__size == 0)
+				return 0;
+			--__size;
+			return __tasks[(__head + __size) & (__capacity - 1)];
+		}
+
+		__task *	pop_front()
+		{
+			__mutex_guard	lock(__mutex);
+			if (__size == 0)
+				return 0;
+			__task	*task = __tasks[__head];
+			__head = (__head + 1) & (__capacity - 1);
+			--__size;
+			return task;
+		}
+
+	private:
+		__work_deque( const __work_deque & );
+		__work_deque &	operator=( const __work_deque & );
+
+		void	__grow()
+		{
+			std::size_t	capacity = __capacity ? __capacity * 2 : 64;
+			__task		**tasks = new __task *[capacity];
+			for (std::size_t i = 0; i < __size; ++i)
+				tasks[i] = __tasks[(__head + i) & (__capacity - 1)];
+			delete[] __tasks;
+			__tasks = tasks;
+			__head = 0;
+			__capacity = capacity;
+		}
+
+		pthread_mutex_t	__mutex;
+		__task			**__tasks;
+		std::size_t		__head;
+		std::size_t		__size;
+		std::size_t		__capacity;
+	};
+}
+
+class thread_pool
+{
+public:
+	// 0 threads means one per online processor
+	explicit thread_pool( std::size_t threads = 0 ) :
+		__count(threads ? threads : detail::__hardware_threads()),
+		__workers(new __worker[__count + 1]),
+		__queued(0),
+		__sleeping(0),
+		__stopping(false)
+	{
+		pthread_mutex_init(&__sleep_mutex, NULL);
+		pthread_cond_init(&__wake, NULL);
+		for (std::size_t i = 0; i <= __count; ++i)
+		{
+			__workers[i].pool = this;
+			__workers[i].index = i;
+		}
+		for (std::size_t i = 0; i < __count; ++i)
+		{
+			if (pthread_create(&__workers[i].thread, NULL, &thread_pool::__main,
+								&__workers[i]) != 0)
+			{
+				__stop(i);
+				throw std::runtime_error("thread_pool: cannot start a worker");
+			}
+		}
+	}
+
+	// waits for the submitted tasks, their exceptions are dropped
+	~thread_pool()
+	{
+		__wait(__detached);
+		__stop(__count);
+	}
+
+	std::size_t	size() const
+	{ return __count; }
+
+	// runs f() on the pool without a group to wait on, see wait()
+	template <class F>
+	void	submit( const F & f )
+	{ __spawn(__detached, f); }
+
+	// waits for everything given to submit(), rethrows the first exception
+	// one of those tasks threw
+	void	wait()
+	{
+		__wait(__detached);
+		__detached.rethrow();
+	}
+
+	// shared pool with one thread per processor, started on first use
+	static thread_pool &	global()
+	{
+		static thread_pool	pool;
+		return pool;
+	}
+
+private:
+	friend class task_group;
+
+	struct __worker
+	{
+		thread_pool				*pool;
+		std::size_t				index;
+		pthread_t				thread;
+		detail::__work_deque	deque;
+	};
+
+	thread_pool( const thread_pool & );
+	thread_pool &	operator=( const thread_pool & );
+
+	static __worker *&	__current()
+	{
+		static __thread __worker	*worker = 0;
+		return worker;
+	}
+
+	template <class F>
+	void	__spawn( detail::__group_state & group, const F & f )
+	{
+		detail::__task	*task = new detail::__task_impl<F>(f);
+		task->group = &group;
+		__atomic_add_fetch(&group.pending, 1, __ATOMIC_RELAXED);
+		try
+		{
+			__push(task);
+		}
+		catch (...)
+		{
+			__atomic_sub_fetch(&group.pending, 1, __ATOMIC_RELAXED);
+			delete task;
+			throw ;
+		}
+	}
+
+	void	__push( detail::__task * task )
+	{
+		__worker	*self = __current();
+		if (self != 0 and self->pool == this)
+			self->deque.push_back(task);
+		else
+			__workers[__count].deque.push_back(task);
+		__atomic_add_fetch(&__queued, 1, __ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&__sleeping, __ATOMIC_SEQ_CST) > 0)
+		{
+			detail::__mutex_guard	lock(__sleep_mutex);
+			pthread_cond_signal(&__wake);
+		}
+	}
+
+	// own deque first, then steal round robin; threads outside the pool
+	// have no deque of their own and steal from every one, the injection
+	// deque included
+	detail::__task *	__take( std::size_t self )
+	{
+		detail::__task	*task = 0;
+		std::size_t		victims = __count + 1;
+		if (self < __count)
+		{
+			task = __workers[self].deque.pop_back();
+			--victims;
+		}
+		for (std::size_t i = 1; task == 0 and i <= victims; ++i)
+			task = __workers[(self + i) % (__count + 1)].deque.pop_front();
+		if (task != 0)
+			__atomic_sub_fetch(&__queued, 1, __ATOMIC_SEQ_CST);
+		return task;
+	}
+
+	void	__execute( detail::__task * task )
+	{
+		detail::__group_state	*group = task->group;
+		try
+		{
+			task->run();
+		}
+# if FT_CXX11
+		catch (...)
+		{
+			if (not __atomic_exchange_n(&group->failed, true, __ATOMIC_ACQ_REL))
+				group->error = std::current_exception();
+		}
+# else
+		catch (std::exception & e)
+		{
+			if (not __atomic_exchange_n(&group->failed, true, __ATOMIC_ACQ_REL))
+				group->error = e.what();
+		}
+		catch (...)
+		{
+			if (not __atomic_exchange_n(&group->failed, true, __ATOMIC_ACQ_REL))
+				group->error = "thread_pool: unknown exception in a task";
+		}
+# endif
+		delete task;
+		__atomic_sub_fetch(&group->pending, 1, __ATOMIC_RELEASE);
+	}
+
+	// runs other tasks until the group is done
+	void	__wait( detail::__group_state & group )
+	{
+		__worker	*self = __current();
+		std::size_t	index = (self != 0 and self->pool == this) ? self->index : __count;
+		while (not group.done())
+		{
+			detail::__task	*task = __take(index);
+			if (task != 0)
+				__execute(task);
+			else
+				sched_yield();
+		}
+	}
+
+	void	__loop( __worker & self )
+	{
+		for (;;)
+		{
+			detail::__task	*task = __take(self.index);
+			if (task != 0)
+			{
+				__execute(task);
+				continue ;
+			}
+			detail::__mutex_guard	lock(__sleep_mutex);
+			__atomic_add_fetch(&__sleeping, 1, __ATOMIC_SEQ_CST);
+			while (__atomic_load_n(&__queued, __ATOMIC_SEQ_CST) <= 0 and not __stopping)
+				pthread_cond_wait(&__wake, &__sleep_mutex);
+			__atomic_sub_fetch(&__sleeping, 1, __ATOMIC_SEQ_CST);
+			if (__stopping)
+				return ;
+		}
+	}
+
+	static void *	__main( void * arg )
+	{
+		__worker	*self = static_cast<__worker *>(arg);
+		__current() = self;
+		self->pool->__loop(*self);
+		return 0;
+	}
+
+	// joins the first n workers
+	void	__stop( std::size_t n )
+	{
+		{
+			detail::__mutex_guard	lock(__sleep_mutex);
+			__stopping = true;
+			pthread_cond_broadcast(&__wake);
+		}
+		for (std::size_t i = 0; i < n; ++i)
+			pthread_join(__workers[i].thread, NULL);
+		delete[] __workers;
+		pthread_cond_destroy(&__wake);
+		pthread_mutex_destroy(&__sleep_mutex);
+	}
+
+	std::size_t				__count;
+	__worker				*__workers;
+	long					__queued;
+	long					__sleeping;
+	bool					__stopping;
+	pthread_mutex_t			__sleep_mutex;
+	pthread_cond_t			__wake;
+	detail::__group_state	__detached;
+};
+
+// Set of tasks run on a pool and waited for together.
+// The destructor waits too, but drops the exceptions: call wait() to get
+// the first one a task threw.
+class task_group
+{
+public:
+	explicit task_group( thread_pool & pool = thread_pool::global() ) : __pool(pool)
+	{}
+
+	~task_group()
+	{ __pool.__wait(__state); }
+
+	template <class F>
+	void	run( const F & f )
+	{ __pool.__spawn(__state, f); }
+
+	void	wait()
+	{
+		__pool.__wait(__state);
+		__state.rethrow();
+	}
+
+	thread_pool &	pool() const
+	{ return __pool; }
+
+private:
+	task_group( const task_group & );
+	task_group &	operator=( const task_group & );
+
+	thread_pool				&__pool;
+	detail::__group_state	__state;
+};
+
+} // namespace ft
+
+#endif // FT_THREAD_POOL_HPP
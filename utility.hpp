@@ -13,7 +13,25 @@
 #ifndef FT_UTILS_HPP
 # define FT_UTILS_HPP
 
+# include <new>
 # include <cstddef>
+# include <cstring>
+# include <iterator>
+# include "simd.hpp"
+
+# if __cplusplus >= 201103L
+#  define FT_CXX11 1
+#  include <utility>
+#  include <type_traits>
+#  define FT_NOEXCEPT					noexcept
+#  define FT_MOVE(x)					std::move(x)
+#  define FT_MOVE_IF_NOEXCEPT(x)		std::move_if_noexcept(x)
+# else
+#  define FT_CXX11 0
+#  define FT_NOEXCEPT
+#  define FT_MOVE(x)					(x)
+#  define FT_MOVE_IF_NOEXCEPT(x)		(x)
+# endif
 
 namespace ft
 {
@@ -21,9 +39,9 @@ namespace ft
 template<class T>
 void	swap(T & a, T & b)
 {
-	T tmp = a;
-	a = b;
-	b = tmp;
+	T tmp = FT_MOVE(a);
+	a = FT_MOVE(b);
+	b = FT_MOVE(tmp);
 }
 
 template <class T>
@@ -58,6 +76,14 @@ struct pair
 	
 	template< class U1, class U2 >
 		pair( const pair<U1, U2>& p ) : first(p.first), second(p.second) {}
+
+# if FT_CXX11
+	template< class U1, class U2 >
+		pair( U1&& x, U2&& y ) : first(std::forward<U1>(x)), second(std::forward<U2>(y)) {}
+
+	template< class U1, class U2 >
+		pair( pair<U1, U2>&& p ) : first(std::forward<U1>(p.first)), second(std::forward<U2>(p.second)) {}
+# endif
 };
 
 template< class T1, class T2 >
@@ -183,18 +209,329 @@ struct enable_if<true, T>
 	typedef T	type;
 };
 
+template <bool B, class T, class F>
+struct conditional
+{
+	typedef T	type;
+};
+
+template <class T, class F>
+struct conditional<false, T, F>
+{
+	typedef F	type;
+};
+
+
+
+template <class T, T v>
+struct integral_constant
+{
+	typedef T					value_type;
+	typedef integral_constant	type;
+	static const T value = v;
+};
+
+typedef integral_constant<bool, true>	true_type;
+typedef integral_constant<bool, false>	false_type;
+
+
+
+template <class T>
+struct is_trivially_copyable
+{
+# if defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 5)
+	static const bool value = __is_trivially_copyable(T);
+# elif defined(__GNUC__)
+	static const bool value = __has_trivial_copy(T) and __has_trivial_destructor(T);
+# else
+	static const bool value = is_integral<T>::value;
+# endif
+};
+
+template <class T>
+struct is_trivially_copyable<T *> {
+	static const bool value = true;
+};
+
+// Specialize to true_type for types that stay valid when their bytes are
+// moved to another address, like a handle owning a heap pointer.
+// ft::vector then relocates them with memcpy/memmove, without calling
+// the move constructor and the destructor for every element.
+template <class T>
+struct is_trivially_relocatable :
+	integral_constant<bool, is_trivially_copyable<T>::value>
+{};
+
+template <class T1, class T2>
+struct is_trivially_relocatable< pair<T1, T2> > :
+	integral_constant<bool, is_trivially_relocatable<T1>::value
+							and is_trivially_relocatable<T2>::value>
+{};
+
+template <class T>
+struct is_trivially_destructible
+{
+# if defined(__clang__)
+	static const bool value = __is_trivially_destructible(T);
+# elif defined(__GNUC__)
+	static const bool value = __has_trivial_destructor(T);
+# else
+	static const bool value = is_integral<T>::value;
+# endif
+};
+
+template <class T>
+struct is_trivially_destructible<T *> {
+	static const bool value = true;
+};
+
+template <class T>
+struct is_trivially_default_constructible
+{
+# if defined(__clang__) || defined(__GNUC__)
+	static const bool value = __is_trivially_constructible(T);
+# else
+	static const bool value = is_integral<T>::value;
+# endif
+};
+
+template <class T>
+struct is_trivially_default_constructible<T *> {
+	static const bool value = true;
+};
+
+
+
+template <class T>
+struct __alignment_helper {
+	char	c;
+	T		t;
+};
+
+template <class T>
+struct alignment_of {
+	static const std::size_t value = sizeof(__alignment_helper<T>) - sizeof(T);
+};
+
+
+
+// true for allocators with pointer reallocate(pointer, size_type old_n, size_type new_n),
+// which ft::vector uses to grow trivially relocatable elements in place
+template <class Allocator>
+struct has_reallocate
+{
+private:
+	typedef typename Allocator::pointer		__pointer;
+	typedef typename Allocator::size_type	__size;
+
+	template <class U, __pointer (U::*)(__pointer, __size, __size)>
+	struct __check {};
+
+	template <class U>
+	static char	f(__check<U, &U::reallocate> *);
+
+	template <class U>
+	static int	f(...);
+public:
+	static const bool value = sizeof(f<Allocator>(0)) == sizeof(char);
+};
+
+
+
+// Allocators whose deallocate() does nothing (e.g. ft::pmr::polymorphic_allocator
+// on top of a monotonic_buffer_resource) overload this, so containers can drop
+// their storage without walking it node by node.
+template <class Allocator>
+bool	deallocation_is_noop( const Allocator & )
+{
+	return false;
+}
+
+
+
+template< class Iter >
+struct iterator_traits;
 
+// iterator_concept of iterators over one plain array, as in C++20.
+// Such ranges can be handed to memcmp and the SIMD kernels of simd.hpp.
+struct contiguous_iterator_tag : public std::random_access_iterator_tag
+{};
+
+template <class It>
+struct is_contiguous_iterator {
+private:
+	template <class C>
+	static char	f(typename enable_if<is_same<typename C::iterator_concept,
+						contiguous_iterator_tag>::value, int>::type) {return 0;}
+
+	template <class C>
+	static double	f(...) {return 0;}
+public:
+	static const bool value = sizeof(f<It>(0)) == sizeof(char);
+};
+
+template <class T>
+struct is_contiguous_iterator<T *> {
+	static const bool value = true;
+};
+
+
+
+namespace detail {
+	template <class T>
+	T *		__to_address( T * p )
+	{ return p; }
+
+	template <class It>
+	typename It::pointer	__to_address( It it )
+	{ return it.base(); }
+
+	// how two contiguous ranges of T compare:
+	// 0 element by element, 1 integers compared as bytes,
+	// 2 unsigned bytes (memcmp gives the order too), 3 floating point
+	template <class T>	struct __compare_kind :				integral_constant<int, 0> {};
+	template <>	struct __compare_kind<bool> :				integral_constant<int, 2> {};
+	template <>	struct __compare_kind<unsigned char> :		integral_constant<int, 2> {};
+	template <>	struct __compare_kind<char> :
+							integral_constant<int, ((char) -1 < 0 ? 1 : 2)> {};
+	template <>	struct __compare_kind<signed char> :		integral_constant<int, 1> {};
+	template <>	struct __compare_kind<wchar_t> :			integral_constant<int, 1> {};
+	template <>	struct __compare_kind<short> :				integral_constant<int, 1> {};
+	template <>	struct __compare_kind<unsigned short> :		integral_constant<int, 1> {};
+	template <>	struct __compare_kind<int> :				integral_constant<int, 1> {};
+	template <>	struct __compare_kind<unsigned int> :		integral_constant<int, 1> {};
+	template <>	struct __compare_kind<long> :				integral_constant<int, 1> {};
+	template <>	struct __compare_kind<unsigned long> :		integral_constant<int, 1> {};
+	template <>	struct __compare_kind<long long> :			integral_constant<int, 1> {};
+	template <>	struct __compare_kind<unsigned long long> :	integral_constant<int, 1> {};
+	template <>	struct __compare_kind<float> :				integral_constant<int, 3> {};
+	template <>	struct __compare_kind<double> :				integral_constant<int, 3> {};
+
+	template <class It1, class It2,
+		class V1 = typename remove_const<typename iterator_traits<It1>::value_type>::type,
+		class V2 = typename remove_const<typename iterator_traits<It2>::value_type>::type>
+	struct __compare_dispatch : integral_constant<int,
+			is_contiguous_iterator<It1>::value and is_contiguous_iterator<It2>::value
+			and is_same<V1, V2>::value ? __compare_kind<V1>::value : 0>
+	{};
+
+	template<class InputIt1, class InputIt2>
+	bool	__equal( InputIt1 first1, InputIt1 last1, InputIt2 first2,
+					integral_constant<int, 0> )
+	{
+		for (; first1 != last1; ++first1, ++first2) {
+			if (!(*first1 == *first2)) {
+				return false;
+			}
+		}
+		return true;
+	}
+
+	template<class It1, class It2>
+	bool	__equal_bytes( It1 first1, It1 last1, It2 first2 )
+	{
+		std::size_t	n = last1 - first1;
+		if (n == 0)
+			return true;
+		return std::memcmp(detail::__to_address(first1), detail::__to_address(first2),
+							n * sizeof(*detail::__to_address(first1))) == 0;
+	}
 
+	template<class It1, class It2>
+	bool	__equal( It1 first1, It1 last1, It2 first2, integral_constant<int, 1> )
+	{ return detail::__equal_bytes(first1, last1, first2); }
+
+	template<class It1, class It2>
+	bool	__equal( It1 first1, It1 last1, It2 first2, integral_constant<int, 2> )
+	{ return detail::__equal_bytes(first1, last1, first2); }
+
+	template<class It1, class It2>
+	bool	__equal( It1 first1, It1 last1, It2 first2, integral_constant<int, 3> )
+	{
+		std::size_t	n = last1 - first1;
+		if (n == 0)
+			return true;
+		return detail::__mismatch_float(detail::__to_address(first1),
+										detail::__to_address(first2), n, false) == n;
+	}
+
+	template<class InputIt1, class InputIt2>
+	bool	__lexicographical_compare( InputIt1 first1, InputIt1 last1,
+						InputIt2 first2, InputIt2 last2, integral_constant<int, 0> )
+	{
+		for ( ; (first1 != last1) && (first2 != last2); ++first1, (void) ++first2 ) {
+			if (*first1 < *first2)
+				return true;
+			if (*first2 < *first1)
+				return false;
+		}
+		return (first1 == last1) && (first2 != last2);
+	}
+
+	template<class It1, class It2>
+	bool	__lexicographical_compare( It1 first1, It1 last1,
+						It2 first2, It2 last2, integral_constant<int, 1> )
+	{
+		std::size_t	n1 = last1 - first1;
+		std::size_t	n2 = last2 - first2;
+		std::size_t	n = n1 < n2 ? n1 : n2;
+		if (n != 0)
+		{
+			std::size_t	size = sizeof(*detail::__to_address(first1));
+			std::size_t	i = detail::__mismatch_bytes(detail::__to_address(first1),
+											detail::__to_address(first2),
+											n * size) / size;
+			if (i < n)
+				return first1[i] < first2[i];
+		}
+		return n1 < n2;
+	}
+
+	template<class It1, class It2>
+	bool	__lexicographical_compare( It1 first1, It1 last1,
+						It2 first2, It2 last2, integral_constant<int, 2> )
+	{
+		std::size_t	n1 = last1 - first1;
+		std::size_t	n2 = last2 - first2;
+		std::size_t	n = n1 < n2 ? n1 : n2;
+		if (n != 0)
+		{
+			int	res = std::memcmp(detail::__to_address(first1),
+								detail::__to_address(first2), n);
+			if (res != 0)
+				return res < 0;
+		}
+		return n1 < n2;
+	}
+
+	template<class It1, class It2>
+	bool	__lexicographical_compare( It1 first1, It1 last1,
+						It2 first2, It2 last2, integral_constant<int, 3> )
+	{
+		std::size_t	n1 = last1 - first1;
+		std::size_t	n2 = last2 - first2;
+		std::size_t	n = n1 < n2 ? n1 : n2;
+		if (n != 0)
+		{
+			std::size_t	i = detail::__mismatch_float(detail::__to_address(first1),
+											detail::__to_address(first2),
+											n, true);
+			if (i < n)
+				return first1[i] < first2[i];
+		}
+		return n1 < n2;
+	}
+}
+
+// Contiguous ranges of integers are compared with memcmp, those of float
+// and double with the SIMD kernels of simd.hpp. Anything else goes
+// element by element.
 template<class InputIt1, class InputIt2>
 bool	equal(InputIt1 first1, InputIt1 last1, 
 		InputIt2 first2)
 {
-	for (; first1 != last1; ++first1, ++first2) {
-		if (!(*first1 == *first2)) {
-			return false;
-		}
-	}
-	return true;
+	return detail::__equal(first1, last1, first2,
+				integral_constant<int, detail::__compare_dispatch<InputIt1, InputIt2>::value>());
 }
 
 
@@ -203,13 +540,8 @@ template<class InputIt1, class InputIt2>
 bool	lexicographical_compare(InputIt1 first1, InputIt1 last1,
 							InputIt2 first2, InputIt2 last2)
 {
-    for ( ; (first1 != last1) && (first2 != last2); ++first1, (void) ++first2 ) {
-        if (*first1 < *first2)
-			return true;
-        if (*first2 < *first1)
-			return false;
-    }
-    return (first1 == last1) && (first2 != last2);
+	return detail::__lexicographical_compare(first1, last1, first2, last2,
+				integral_constant<int, detail::__compare_dispatch<InputIt1, InputIt2>::value>());
 }
 
 
@@ -467,6 +799,113 @@ private:
 
 
 
+// Random access iterator over plain contiguous storage, shared by the
+// containers that keep their elements in one array (small_vector, ...).
+// contiguous_iterator<T> converts to contiguous_iterator<const T>.
+template <class T>
+class contiguous_iterator :
+	public ft::iterator<std::random_access_iterator_tag,
+						typename remove_const<T>::type, std::ptrdiff_t, T*, T&>
+{
+private:
+	T	* __ptr;
+public:
+	typedef T *						iterator_type;
+	typedef std::ptrdiff_t			difference_type;
+	typedef contiguous_iterator_tag	iterator_concept;
+
+	contiguous_iterator() : __ptr(NULL) {}
+	contiguous_iterator(T * ptr) : __ptr(ptr) {}
+	contiguous_iterator(const contiguous_iterator<typename remove_const<T>::type> & other) :
+		__ptr(other.base()) {}
+
+	T *	base() const {
+		return __ptr;
+	}
+	T &	operator*() const {
+		return *__ptr;
+	}
+	T *	operator->() const {
+		return __ptr;
+	}
+	T &	operator[](difference_type n) const {
+		return __ptr[n];
+	}
+	contiguous_iterator &	operator++() {
+		++__ptr;
+		return *this;
+	}
+	contiguous_iterator		operator++(int) {
+		contiguous_iterator tmp(*this);
+		++__ptr;
+		return tmp;
+	}
+	contiguous_iterator &	operator--() {
+		--__ptr;
+		return *this;
+	}
+	contiguous_iterator		operator--(int) {
+		contiguous_iterator tmp(*this);
+		--__ptr;
+		return tmp;
+	}
+	contiguous_iterator &	operator+=(difference_type n) {
+		__ptr += n;
+		return *this;
+	}
+	contiguous_iterator &	operator-=(difference_type n) {
+		__ptr -= n;
+		return *this;
+	}
+	contiguous_iterator		operator+(difference_type n) const {
+		return contiguous_iterator(__ptr + n);
+	}
+	contiguous_iterator		operator-(difference_type n) const {
+		return contiguous_iterator(__ptr - n);
+	}
+
+	friend contiguous_iterator	operator+(difference_type n, contiguous_iterator it)
+	{ return it + n; }
+	friend difference_type	operator-(contiguous_iterator lhs, contiguous_iterator rhs)
+	{ return lhs.__ptr - rhs.__ptr; }
+	friend bool operator==(contiguous_iterator lhs, contiguous_iterator rhs)
+	{ return lhs.__ptr == rhs.__ptr; }
+	friend bool operator!=(contiguous_iterator lhs, contiguous_iterator rhs)
+	{ return lhs.__ptr != rhs.__ptr; }
+	friend bool operator<(contiguous_iterator lhs, contiguous_iterator rhs)
+	{ return lhs.__ptr < rhs.__ptr; }
+	friend bool operator>(contiguous_iterator lhs, contiguous_iterator rhs)
+	{ return lhs.__ptr > rhs.__ptr; }
+	friend bool operator<=(contiguous_iterator lhs, contiguous_iterator rhs)
+	{ return lhs.__ptr <= rhs.__ptr; }
+	friend bool operator>=(contiguous_iterator lhs, contiguous_iterator rhs)
+	{ return lhs.__ptr >= rhs.__ptr; }
+};
+
+
+
+union __max_align_type
+{
+	long double	__ld;
+	long long	__ll;
+	double		__d;
+	void		*__p;
+};
+
+// raw storage for objects built in place; pass alignment_of<T>::value
+// for an over-aligned T, the default is the strictest fundamental one
+template <std::size_t Size, std::size_t Align = alignment_of<__max_align_type>::value>
+struct aligned_buffer
+{
+# if FT_CXX11
+	alignas(Align) char	data[Size ? Size : 1];
+# else
+	char	data[Size ? Size : 1] __attribute__((aligned(Align)));
+# endif
+};
+
+
+
 namespace detail {
 	template<class It>
 	typename ft::iterator_traits<It>::difference_type 
@@ -518,6 +957,163 @@ typename ft::iterator_traits<It>::difference_type
 
 
 
+namespace detail {
+	// Raw memory helpers for the containers that manage their own storage
+	// (small_vector, static_vector, ...). Objects are built with placement
+	// new, so they don't go through an allocator's construct().
+
+	template <class T>
+	void	__destroy( T * first, T * last )
+	{
+		if (is_trivially_destructible<T>::value)
+			return ;
+		for (; first != last; ++first)
+			first->~T();
+	}
+
+	// the __uninitialized_* functions construct into raw memory at dest
+	// and return the end of the new range. If a constructor throws, what
+	// they have built is destroyed again.
+	template <class It, class T>
+	T *		__uninitialized_copy( It first, It last, T * dest, true_type )
+	{
+		std::size_t	n = last - first;
+		if (n != 0)
+			std::memcpy(static_cast<void *>(dest), first, n * sizeof(T));
+		return dest + n;
+	}
+
+	template <class It, class T>
+	T *		__uninitialized_copy( It first, It last, T * dest, false_type )
+	{
+		T	*cur = dest;
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				::new (static_cast<void *>(cur)) T(*first);
+		}
+		catch (...)
+		{
+			detail::__destroy(dest, cur);
+			throw ;
+		}
+		return cur;
+	}
+
+	template <class It, class T>
+	T *		__uninitialized_copy( It first, It last, T * dest )
+	{
+		return detail::__uninitialized_copy(first, last, dest,
+				integral_constant<bool, is_trivially_copyable<T>::value
+					and (is_same<It, T *>::value or is_same<It, const T *>::value)>());
+	}
+
+	template <class T>
+	T *		__uninitialized_fill( T * dest, std::size_t n, const T & value )
+	{
+		T	*cur = dest;
+		try
+		{
+			for (; n != 0; --n, ++cur)
+				::new (static_cast<void *>(cur)) T(value);
+		}
+		catch (...)
+		{
+			detail::__destroy(dest, cur);
+			throw ;
+		}
+		return cur;
+	}
+
+	// moves when the move constructor can't throw, copies otherwise, so
+	// on failure the source is still intact
+	template <class T>
+	T *		__uninitialized_move( T * first, T * last, T * dest )
+	{
+		T	*cur = dest;
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				::new (static_cast<void *>(cur)) T(FT_MOVE_IF_NOEXCEPT(*first));
+		}
+		catch (...)
+		{
+			detail::__destroy(dest, cur);
+			throw ;
+		}
+		return cur;
+	}
+
+	// moves [first, last) into raw memory at dest, which doesn't overlap
+	// it, and ends the lifetime of the source. Strong guarantee.
+	template <class T>
+	void	__relocate( T * first, T * last, T * dest )
+	{
+		if (is_trivially_relocatable<T>::value)
+		{
+			if (first != last)
+				std::memcpy(static_cast<void *>(dest), first, (last - first) * sizeof(T));
+			return ;
+		}
+		detail::__uninitialized_move(first, last, dest);
+		detail::__destroy(first, last);
+	}
+
+	// same as __relocate, but the ranges may overlap. If a copy throws,
+	// every element of both ranges is destroyed before rethrowing.
+	template <class T>
+	void	__shift( T * first, T * last, T * dest )
+	{
+		if (is_trivially_relocatable<T>::value)
+		{
+			if (first != last)
+				std::memmove(static_cast<void *>(dest), first, (last - first) * sizeof(T));
+			return ;
+		}
+		if (dest < first)
+		{
+			T	*cur = dest;
+			try
+			{
+				for (; first != last; ++first, ++cur)
+				{
+					::new (static_cast<void *>(cur)) T(FT_MOVE_IF_NOEXCEPT(*first));
+					first->~T();
+				}
+			}
+			catch (...)
+			{
+				detail::__destroy(dest, cur);
+				detail::__destroy(first, last);
+				throw ;
+			}
+		}
+		else if (dest > first)
+		{
+			T	*end = dest + (last - first);
+			T	*cur = end;
+			try
+			{
+				while (last != first)
+				{
+					--last;
+					--cur;
+					::new (static_cast<void *>(cur)) T(FT_MOVE_IF_NOEXCEPT(*last));
+					last->~T();
+				}
+			}
+			catch (...)
+			{
+				detail::__destroy(cur + 1, end);
+				detail::__destroy(first, last + 1);
+				throw ;
+			}
+		}
+	}
+}
+
+
+
 } // namespace ft
 
 
@@ -15,6 +15,9 @@
 
 # include <memory>
 # include <cstddef>
+# include <cstring>
+# include <limits>
+# include <functional>
 # include <iostream>
 # include <stdexcept>
 # include "utility.hpp"
@@ -22,12 +25,70 @@
 namespace ft
 {
 
+// Growth policies for ft::vector: next() gets the current capacity, the
+// size that has to fit and sizeof(T), and returns the new capacity.
+// vector clamps the result to [required, max_size()].
+namespace growth
+{
+	struct doubling
+	{
+		static std::size_t	next( std::size_t capacity, std::size_t required, std::size_t )
+		{ return ft::max(capacity * 2, required); }
+	};
+
+	struct one_and_half
+	{
+		static std::size_t	next( std::size_t capacity, std::size_t required, std::size_t )
+		{ return ft::max(capacity + capacity / 2, required); }
+	};
+
+	template< std::size_t Increment >
+	struct fixed_increment
+	{
+		static std::size_t	next( std::size_t capacity, std::size_t required, std::size_t )
+		{ return ft::max(capacity + Increment, required); }
+	};
+
+	// grows by 1.5 and rounds the byte size up to the size classes
+	// malloc rounds to anyway, so the slack becomes usable capacity
+	struct size_class
+	{
+		static std::size_t	next( std::size_t capacity, std::size_t required, std::size_t elem_size )
+		{
+			std::size_t	bytes = ft::max(capacity + capacity / 2, required) * elem_size;
+			if (bytes <= 128)
+				bytes = (bytes + 15) & ~(std::size_t) 15;
+			else if (bytes < 4096 * 4)
+			{
+				// four classes between two powers of two
+				std::size_t	step = 1;
+				while (step * 8 < bytes)
+					step <<= 1;
+				bytes = (bytes + step - 1) & ~(step - 1);
+			}
+			else
+				bytes = (bytes + 4095) & ~(std::size_t) 4095;
+			return bytes / elem_size;
+		}
+	};
 
-template<class T, class Allocator = std::allocator<T> >
+	// doubles, but spreads the copy over the next push_backs instead of
+	// doing it at once: vector<T, Allocator, growth::incremental> is a
+	// specialization, see incremental_vector.hpp
+	struct incremental
+	{
+		static std::size_t	next( std::size_t capacity, std::size_t required, std::size_t )
+		{ return ft::max(capacity * 2, required); }
+	};
+}
+
+
+template<class T, class Allocator = std::allocator<T>, class Growth = growth::doubling >
 class vector {
 public:
 	typedef T									value_type;
 	typedef Allocator							allocator_type;
+	typedef Growth								growth_policy;
 	typedef std::size_t							size_type;
 	typedef std::ptrdiff_t						difference_type;
 	typedef value_type&							reference;
@@ -53,6 +114,10 @@ public:
 	vector( const vector& other );
 	~vector();
 	vector& operator=( const vector& other );
+# if FT_CXX11
+	vector( vector&& other ) noexcept;
+	vector& operator=( vector&& other );
+# endif
 	void assign( size_type count, const T& value );
 	
 	template< class InputIt >
@@ -76,11 +141,26 @@ public:
 	size_type	max_size() const;
 	
 	void		reserve( size_type new_cap );
+	void		shrink_to_fit();
 	void		clear();
 	void		push_back( const T& value );
+# if FT_CXX11
+	void		push_back( T&& value );
+	template< class... Args >
+	void		emplace_back( Args&&... args );
+# endif
 	size_type	capacity() const;
 	void		pop_back();
 	void		resize( size_type count, T value = T() );
+	// new elements are default-initialized: left as they are for trivial T
+	void		resize_default_init( size_type count );
+	// resize_default_init restricted to trivially default constructible T
+	void		resize_uninitialized( size_type count );
+	// insert at the end with a single capacity check and a bulk copy
+	template< class InputIt >
+	void		append( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+						InputIt last );
+	void		append( const T* ptr, size_type n );
 	void		swap( vector& other );
 	
 	iterator				begin();
@@ -97,11 +177,47 @@ public:
 	template < class InputIt >
 	void		insert( iterator pos, typename enable_if<is_iterator<InputIt>::value, 
 							InputIt>::type first, InputIt last );
+# if FT_CXX11
+	iterator	insert( iterator pos, T&& value );
+	template< class... Args >
+	iterator	emplace( iterator pos, Args&&... args );
+# endif
 	
 	iterator erase( iterator pos );
 	iterator erase( iterator first, iterator last );
 private:
-	void	clear_all();
+	// ranges that are plain memory of trivially copyable T are copied with memcpy
+	template< class It >
+	struct __is_bitwise_source : integral_constant<bool,
+			is_trivially_copyable<T>::value and
+			(is_same<It, T *>::value or is_same<It, const T *>::value
+			or is_same<It, iterator>::value or is_same<It, const_iterator>::value)>
+	{};
+
+	// storage of trivially relocatable T can be resized in place
+	// when the allocator offers reallocate()
+	typedef integral_constant<bool, is_trivially_relocatable<T>::value
+				and has_reallocate<Allocator>::value>	__can_reallocate;
+
+	void		clear_all();
+	bool		__resize_storage( size_type new_cap );
+	bool		__resize_storage( size_type new_cap, true_type );
+	bool		__resize_storage( size_type new_cap, false_type );
+	size_type	__recommend( size_type new_size ) const;
+	void		__reallocate( T * new_data, size_type new_cap,
+							size_type pos = 0, size_type gap = 0 );
+	void		__transfer( T * dest, T * first, T * last );
+	void		__destroy( T * first, T * last );
+	void		__fill_construct( T * dest, size_type count, const T& value );
+	void		__default_construct( T * dest, size_type count );
+	template< class InputIt >
+	void		__copy_construct( T * dest, InputIt first, InputIt last );
+	template< class InputIt >
+	void		__copy_construct( T * dest, InputIt first, InputIt last, true_type );
+	template< class InputIt >
+	void		__copy_construct( T * dest, InputIt first, InputIt last, false_type );
+	void		__open_gap( size_type pos, size_type count );
+	void		__close_gap( size_type pos, size_type count );
 private:
 	size_type	__size;
 	size_type	__capacity;
@@ -111,70 +227,282 @@ private:
 
 
 
-template<class T, class Allocator>
-void	vector<T, Allocator>::clear_all()
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::clear_all()
 {
-	for (size_type i = 0; i < __size; ++i)
-		__alloc.destroy(__data + i);
+	__destroy(__data, __data + __size);
 	__alloc.deallocate(__data, __capacity);
 	__data = 0;
 	__capacity = 0;
 	__size = 0;
 }
 
-template<class T, class Allocator>
-vector<T, Allocator>::vector() : __size(0), __capacity(0), __alloc()
+template<class T, class Allocator, class Growth>
+bool	vector<T, Allocator, Growth>::__resize_storage( size_type new_cap )
+{
+	return __resize_storage(new_cap, __can_reallocate());
+}
+
+template<class T, class Allocator, class Growth>
+bool	vector<T, Allocator, Growth>::__resize_storage( size_type new_cap, true_type )
+{
+	__data = __alloc.reallocate(__data, __capacity, new_cap);
+	__capacity = new_cap;
+	return true;
+}
+
+template<class T, class Allocator, class Growth>
+bool	vector<T, Allocator, Growth>::__resize_storage( size_type, false_type )
+{
+	return false;
+}
+
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::size_type	vector<T, Allocator, Growth>::__recommend( size_type new_size ) const
+{
+	if (new_size > max_size())
+		throw std::length_error("vector");
+	if (__capacity >= max_size() / 2)
+		return max_size();
+	size_type	cap = Growth::next(__capacity, new_size, sizeof(T));
+	if (cap < new_size)
+		return new_size;
+	return ft::min(cap, max_size());
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::__destroy( T * first, T * last )
+{
+	if (is_trivially_destructible<T>::value)
+		return ;
+	for (; first != last; ++first)
+		__alloc.destroy(first);
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::__transfer( T * dest, T * first, T * last )
+{
+	// moves when the move constructor can't throw, copies otherwise
+	T * start = dest;
+	try
+	{
+		for (; first != last; ++first, ++dest)
+			__alloc.construct(dest, FT_MOVE_IF_NOEXCEPT(*first));
+	}
+	catch (...)
+	{
+		__destroy(start, dest);
+		throw ;
+	}
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::__default_construct( T * dest, size_type count )
+{
+	if (is_trivially_default_constructible<T>::value)
+		return ;
+	size_type i;
+	try
+	{
+		for (i = 0; i < count; ++i)
+			::new (static_cast<void *>(dest + i)) T;
+	}
+	catch (...)
+	{
+		__destroy(dest, dest + i);
+		throw ;
+	}
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::__fill_construct( T * dest, size_type count, const T& value )
+{
+	size_type i;
+	try
+	{
+		for (i = 0; i < count; ++i)
+			__alloc.construct(dest + i, value);
+	}
+	catch (...)
+	{
+		__destroy(dest, dest + i);
+		throw ;
+	}
+}
+
+template<class T, class Allocator, class Growth>
+template< class InputIt >
+void	vector<T, Allocator, Growth>::__copy_construct( T * dest, InputIt first, InputIt last )
+{
+	__copy_construct(dest, first, last, __is_bitwise_source<InputIt>());
+}
+
+template<class T, class Allocator, class Growth>
+template< class InputIt >
+void	vector<T, Allocator, Growth>::__copy_construct( T * dest, InputIt first, InputIt last, true_type )
+{
+	if (first != last)
+		std::memcpy(static_cast<void *>(dest), &*first, (last - first) * sizeof(T));
+}
+
+template<class T, class Allocator, class Growth>
+template< class InputIt >
+void	vector<T, Allocator, Growth>::__copy_construct( T * dest, InputIt first, InputIt last, false_type )
+{
+	T * start = dest;
+	try
+	{
+		for (; first != last; ++first, ++dest)
+			__alloc.construct(dest, *first);
+	}
+	catch (...)
+	{
+		__destroy(start, dest);
+		throw ;
+	}
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::__reallocate( T * new_data, size_type new_cap,
+											size_type pos, size_type gap )
 {
-	__data = __alloc.allocate(0);
+	// strong exception guarantee
+	// new_data[pos, pos + gap) is already constructed by the caller,
+	// the elements are placed around it
+	if (is_trivially_relocatable<T>::value)
+	{
+		// the old buffer is released as raw memory, nothing to destroy
+		if (pos != 0)
+			std::memcpy(static_cast<void *>(new_data), __data, pos * sizeof(T));
+		if (pos != __size)
+			std::memcpy(static_cast<void *>(new_data + pos + gap), __data + pos,
+						(__size - pos) * sizeof(T));
+	}
+	else
+	{
+		size_type	done = 0;
+		try
+		{
+			__transfer(new_data, __data, __data + pos);
+			done = pos;
+			__transfer(new_data + pos + gap, __data + pos, __data + __size);
+		}
+		catch (...)
+		{
+			__destroy(new_data, new_data + done);
+			__destroy(new_data + pos, new_data + pos + gap);
+			__alloc.deallocate(new_data, new_cap);
+			throw ;
+		}
+		__destroy(__data, __data + __size);
+	}
+	__alloc.deallocate(__data, __capacity);
+	__data = new_data;
+	__capacity = new_cap;
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::__open_gap( size_type pos, size_type count )
+{
+	// basic exception guarantee
+	// moves [pos, size) to [pos + count, size + count), the gap is left unconstructed
+	if (is_trivially_relocatable<T>::value)
+	{
+		if (pos != __size)
+			std::memmove(static_cast<void *>(__data + pos + count), __data + pos,
+						(__size - pos) * sizeof(T));
+		return ;
+	}
+	size_type i = __size;
+	try
+	{
+		for (; i > pos; --i)
+		{
+			__alloc.construct(__data + i - 1 + count, FT_MOVE_IF_NOEXCEPT(__data[i - 1]));
+			__alloc.destroy(__data + i - 1);
+		}
+	}
+	catch (...)
+	{
+		__destroy(__data, __data + i);
+		__destroy(__data + i + count, __data + __size + count);
+		__size = 0;
+		throw ;
+	}
 }
 
-template<class T, class Allocator>
-vector<T, Allocator>::vector( const Allocator& alloc ) :
-	__size(0), __capacity(0), __alloc(alloc)
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::__close_gap( size_type pos, size_type count )
 {
-	__data = __alloc.allocate(0);
+	// basic exception guarantee
+	// [pos, pos + count) is already destroyed, the tail is moved down over it
+	if (is_trivially_relocatable<T>::value)
+	{
+		if (pos + count != __size)
+			std::memmove(static_cast<void *>(__data + pos), __data + pos + count,
+						(__size - pos - count) * sizeof(T));
+		return ;
+	}
+	size_type i = pos + count;
+	try
+	{
+		for (; i < __size; ++i)
+		{
+			__alloc.construct(__data + i - count, FT_MOVE_IF_NOEXCEPT(__data[i]));
+			__alloc.destroy(__data + i);
+		}
+	}
+	catch (...)
+	{
+		__destroy(__data, __data + i - count);
+		__destroy(__data + i, __data + __size);
+		__size = 0;
+		throw ;
+	}
 }
 
-template<class T, class Allocator>
-vector<T, Allocator>::vector( vector<T, Allocator>::size_type count,
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>::vector() :
+	__size(0), __capacity(0), __data(0), __alloc()
+{}
+
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>::vector( const Allocator& alloc ) :
+	__size(0), __capacity(0), __data(0), __alloc(alloc)
+{}
+
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>::vector( vector<T, Allocator, Growth>::size_type count,
 					const T& value ,
 					const Allocator& alloc) :
 					__size(count), __capacity(count), __alloc(alloc)
 {
 	__data = __alloc.allocate(__capacity);
-	size_type i;
 	try
 	{
-		for ( i = 0; i < count; ++i)
-			__alloc.construct(__data + i, value);
+		__fill_construct(__data, count, value);
 	}
 	catch (...)
 	{
-		for (; i > 0; --i)
-			__alloc.destroy(__data + i - 1);
 		__alloc.deallocate(__data, __capacity);
 		throw ;
 	}
 }
 
-template<class T, class Allocator>
+template<class T, class Allocator, class Growth>
 template< class InputIt >
-vector<T, Allocator>::vector(typename enable_if<is_iterator<InputIt>::value, InputIt>::type first, InputIt last,
+vector<T, Allocator, Growth>::vector(typename enable_if<is_iterator<InputIt>::value, InputIt>::type first, InputIt last,
 		const Allocator& alloc) :
-		__alloc(alloc), __size(0), __capacity(0)
+		__size(0), __capacity(0), __alloc(alloc)
 {
 	difference_type n = ft::distance(first, last);
 	__data = __alloc.allocate(n);
-	size_type i;
 	try 
 	{
-		for (i = 0; first != last; ++first, ++i)
-			__alloc.construct(__data + i, *first);
+		__copy_construct(__data, first, last);
 	}
 	catch (...)
 	{
-		for (; i > 0; --i)
-			__alloc.destroy(__data + i - 1);
 		__alloc.deallocate(__data, n);
 		throw ;
 	}
@@ -182,412 +510,478 @@ vector<T, Allocator>::vector(typename enable_if<is_iterator<InputIt>::value, Inp
 	__capacity = n;
 }
 
-template<class T, class Allocator>
-vector<T, Allocator>::vector( const vector& other ) :
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>::vector( const vector& other ) :
 	__size(other.__size),
-	__capacity(other.__capacity),
+	__capacity(other.__size),
 	__alloc(other.__alloc)
 {
 	__data = __alloc.allocate(__capacity);
-	size_type i;
 	try
 	{
-		for ( i = 0; i < __size; ++i)
-			__alloc.construct(__data + i, other.__data[i]);
+		__copy_construct(__data, other.__data, other.__data + __size);
 	}
 	catch (...)
 	{
-		for (; i > 0; --i)
-			__alloc.destroy(__data + i - 1);
 		__alloc.deallocate(__data, __capacity);
 		throw ;
 	}
 }
 
-template<class T, class Allocator>
-vector<T, Allocator>::~vector()
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>::~vector()
 {
-	for (size_type i = 0; i < __size; ++i)
-		__alloc.destroy(__data + i);
+	__destroy(__data, __data + __size);
 	__alloc.deallocate(__data, __capacity);
 }
 
-template<class T, class Allocator>
-vector<T, Allocator>& vector<T, Allocator>::operator=( const vector& other )
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>& vector<T, Allocator, Growth>::operator=( const vector& other )
 {
 	// strong exception guarantee
-	T * tmp = __alloc.allocate(other.__capacity);
-	size_type i;
+	if (this == &other)
+		return *this;
+	T * tmp = __alloc.allocate(other.__size);
 	try
 	{
-		for ( i = 0; i < other.__size; ++i)
-			__alloc.construct(tmp + i, other.__data[i]);
+		__copy_construct(tmp, other.__data, other.__data + other.__size);
 	}
 	catch (...)
 	{
-		for (; i > 0; --i)
-			__alloc.destroy(tmp + i - 1);
-		__alloc.deallocate(tmp, __capacity);
+		__alloc.deallocate(tmp, other.__size);
 		throw ;
 	}
 	this->clear_all();
-	__capacity = other.__capacity;
+	__capacity = other.__size;
 	__size = other.__size;
 	__data = tmp;
 	return *this;
 }
 
-template<class T, class Allocator>
-void vector<T, Allocator>::assign( size_type count, const T& value )
+# if FT_CXX11
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>::vector( vector&& other ) noexcept :
+	__size(other.__size),
+	__capacity(other.__capacity),
+	__data(other.__data),
+	__alloc(other.__alloc)
+{
+	other.__data = 0;
+	other.__size = 0;
+	other.__capacity = 0;
+}
+
+template<class T, class Allocator, class Growth>
+vector<T, Allocator, Growth>& vector<T, Allocator, Growth>::operator=( vector&& other )
 {
-	if (count < __capacity)
+	if (this == &other)
+		return *this;
+	if (__alloc == other.__alloc)
 	{
-		for (size_type i = 0; i < __size; ++i)
-			__alloc.destroy(__data + i);
-		for (size_type i = 0; i < count; ++i)
-		{
-			try
-			{
-				__alloc.construct(__data + i, value);
-			}
-			catch (...)
-			{
-				for (size_type j = 0; j < i; ++j)
-					__alloc.destroy(__data + i);
-				__size = 0;
-				throw ;
-			}
-		}
-		__size = count;
-		return ;
+		// same storage source, the buffer can just change hands
+		this->clear_all();
+		__data = other.__data;
+		__size = other.__size;
+		__capacity = other.__capacity;
+		other.__data = 0;
+		other.__size = 0;
+		other.__capacity = 0;
+		return *this;
 	}
-	T * tmp = __alloc.allocate(count);
-	size_type i;
-	try
+	clear();
+	if (other.__size > __capacity)
 	{
-		for ( i = 0; i < count; ++i)
-			__alloc.construct(tmp + i, value);
+		T * tmp = __alloc.allocate(other.__size);
+		__alloc.deallocate(__data, __capacity);
+		__data = tmp;
+		__capacity = other.__size;
 	}
-	catch (...)
+	for (; __size < other.__size; ++__size)
+		__alloc.construct(__data + __size, std::move(other.__data[__size]));
+	other.clear();
+	return *this;
+}
+# endif
+
+template<class T, class Allocator, class Growth>
+void vector<T, Allocator, Growth>::assign( size_type count, const T& value )
+{
+	if (count > __capacity)
 	{
-		for (; i > 0; --i)
-			__alloc.destroy(tmp + i - 1);
-		__alloc.deallocate(tmp, count);
-		throw ;
+		// strong exception guarantee
+		T * tmp = __alloc.allocate(count);
+		try
+		{
+			__fill_construct(tmp, count, value);
+		}
+		catch (...)
+		{
+			__alloc.deallocate(tmp, count);
+			throw ;
+		}
+		clear_all();
+		__capacity = count;
+		__size = count;
+		__data = tmp;
+		return ;
 	}
-	clear_all();
-	__capacity = count;
+	// basic exception guarantee
+	T copy(value);
+	clear();
+	__fill_construct(__data, count, copy);
 	__size = count;
-	__data = tmp;
 }
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Growth>
 template <class InputIt>
-void vector<T, Allocator>::assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first, InputIt last )
+void vector<T, Allocator, Growth>::assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first, InputIt last )
 {
-	difference_type n = ft::distance(first, last);
-	if (n < __capacity)
+	size_type n = ft::distance(first, last);
+	if (n > __capacity)
 	{
-		for (size_type i = 0; i < __size; ++i)
-			__alloc.destroy(__data + i);
-		for (size_type i = 0; i < n; ++i, ++first)
+		// strong exception guarantee
+		T * tmp = __alloc.allocate(n);
+		try
 		{
-			try
-			{
-				__alloc.construct(__data + i, *first);
-			}
-			catch (...)
-			{
-				for (size_type j = 0; j < i; ++j)
-					__alloc.destroy(__data + i);
-				__size = 0;
-				throw ;
-			}
+			__copy_construct(tmp, first, last);
 		}
+		catch (...)
+		{
+			__alloc.deallocate(tmp, n);
+			throw ;
+		}
+		clear_all();
+		__data = tmp;
 		__size = n;
+		__capacity = n;
 		return ;
 	}
-	T * tmp = __alloc.allocate(n);
-	size_type i;
-	try
-	{
-		for ( i = 0; first != last; ++first, ++i)
-			__alloc.construct(tmp + i, *first);
-	}
-	catch (...)
-	{
-		for (; i > 0; --i)
-			__alloc.destroy(tmp + i - 1);
-		__alloc.deallocate(tmp, n);
-		throw ;
-	}
-	clear_all();
-	__data = tmp;
+	// basic exception guarantee
+	clear();
+	__copy_construct(__data, first, last);
 	__size = n;
-	__capacity = n;
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::allocator_type vector<T, Allocator>::get_allocator() const
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::allocator_type vector<T, Allocator, Growth>::get_allocator() const
 {
 	return __alloc;
 }
 
-template<class T, class Allocator>
-void vector<T, Allocator>::clear()
+template<class T, class Allocator, class Growth>
+void vector<T, Allocator, Growth>::clear()
 {
 	for (size_type i = 0; i < __size; ++i)
 		__alloc.destroy(__data + i);
 	__size = 0;
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::at( size_type pos )
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::reference vector<T, Allocator, Growth>::at( size_type pos )
 {
 	if (pos >= __size)
 		throw std::out_of_range("vector");
 	return __data[pos];
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::at( size_type pos ) const
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_reference vector<T, Allocator, Growth>::at( size_type pos ) const
 {
 	if (pos >= __size)
 		throw std::out_of_range("vector");
 	return __data[pos];
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::operator[]( size_type pos )
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::reference vector<T, Allocator, Growth>::operator[]( size_type pos )
 {
 	return __data[pos];
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::operator[]( size_type pos ) const
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_reference vector<T, Allocator, Growth>::operator[]( size_type pos ) const
 {
 	return __data[pos];
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::front()
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::reference vector<T, Allocator, Growth>::front()
 {
 	return __data[0];
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::front() const
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_reference vector<T, Allocator, Growth>::front() const
 {
 	return __data[0];
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::reference vector<T, Allocator>::back()
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::reference vector<T, Allocator, Growth>::back()
 {
 	return __data[__size - 1];
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::const_reference vector<T, Allocator>::back() const
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_reference vector<T, Allocator, Growth>::back() const
 {
 	return __data[__size - 1];
 }
 
-template<class T, class Allocator>
-T*	vector<T, Allocator>::data()
+template<class T, class Allocator, class Growth>
+T*	vector<T, Allocator, Growth>::data()
 {
 	return __data;
 }
 
-template<class T, class Allocator>
-const T*	vector<T, Allocator>::data() const
+template<class T, class Allocator, class Growth>
+const T*	vector<T, Allocator, Growth>::data() const
 {
 	return __data;
 }
 
-template<class T, class Allocator>
-bool	vector<T, Allocator>::empty() const
+template<class T, class Allocator, class Growth>
+bool	vector<T, Allocator, Growth>::empty() const
 {
 	return __size == 0;
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::size_type	vector<T, Allocator>::size() const
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::size_type	vector<T, Allocator, Growth>::size() const
 {
 	return __size;
 }
 
-template<class T, class Allocator>
-void	vector<T, Allocator>::push_back( const T& value )
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::push_back( const T& value )
 {
 	// strong exception guarantee
-	if (__capacity == 0)
+	if (__size == __capacity and __can_reallocate::value)
 	{
-		__alloc.deallocate(__data, 0);
-		__data = __alloc.allocate(1);
-		__capacity = 1;
+		// value may live in the block that is about to move
+		std::less<const T *>	less;
+		bool		inside = not less(&value, __data) and less(&value, __data + __size);
+		size_type	idx = inside ? &value - __data : 0;
+		__resize_storage(__recommend(__size + 1));
+		__alloc.construct(__data + __size, inside ? __data[idx] : value);
 	}
 	else if (__size == __capacity)
 	{
-		T * tmp = __alloc.allocate(__capacity << 1);
-		size_type i;
+		size_type	new_cap = __recommend(__size + 1);
+		T * tmp = __alloc.allocate(new_cap);
 		try
 		{
-			for ( i = 0; i < __size; ++i)
-				__alloc.construct(tmp + i, __data[i]);
+			__alloc.construct(tmp + __size, value);
 		}
 		catch (...)
 		{
-			for (; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, __capacity << 1);
+			__alloc.deallocate(tmp, new_cap);
 			throw ;
 		}
-		for (size_type i = 0; i < __size; ++i)
-			__alloc.destroy(__data + i);
-		__alloc.deallocate(__data, __capacity);
-		__data = tmp;
-		__capacity <<= 1;
+		__reallocate(tmp, new_cap, __size, 1);
 	}
-	__alloc.construct(__data + __size, value);
+	else
+		__alloc.construct(__data + __size, value);
 	__size++;
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::size_type	vector<T, Allocator>::capacity() const
+# if FT_CXX11
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::push_back( T&& value )
 {
-	return __capacity;
+	emplace_back(std::move(value));
 }
 
-template<class T, class Allocator>
-void	vector<T, Allocator>::pop_back()
+template<class T, class Allocator, class Growth>
+template< class... Args >
+void	vector<T, Allocator, Growth>::emplace_back( Args&&... args )
 {
-	__alloc.destroy(__data + __size);
-	--__size;
+	// strong exception guarantee
+	if (__size == __capacity and __can_reallocate::value)
+	{
+		// args may refer to the block that is about to move: build the
+		// element aside and relocate its bytes once the storage has grown
+		typename std::aligned_storage<sizeof(T), alignof(T)>::type	buf;
+		T *	tmp = reinterpret_cast<T *>(&buf);
+		__alloc.construct(tmp, std::forward<Args>(args)...);
+		try
+		{
+			__resize_storage(__recommend(__size + 1));
+		}
+		catch (...)
+		{
+			__alloc.destroy(tmp);
+			throw ;
+		}
+		std::memcpy(static_cast<void *>(__data + __size), tmp, sizeof(T));
+	}
+	else if (__size == __capacity)
+	{
+		// the new element goes first: args may refer to an element
+		// of the old buffer
+		size_type	new_cap = __recommend(__size + 1);
+		T * tmp = __alloc.allocate(new_cap);
+		try
+		{
+			__alloc.construct(tmp + __size, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			__alloc.deallocate(tmp, new_cap);
+			throw ;
+		}
+		__reallocate(tmp, new_cap, __size, 1);
+	}
+	else
+		__alloc.construct(__data + __size, std::forward<Args>(args)...);
+	__size++;
 }
+# endif
 
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::size_type	vector<T, Allocator, Growth>::capacity() const
+{
+	return __capacity;
+}
 
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::pop_back()
+{
+	__alloc.destroy(__data + __size - 1);
+	--__size;
+}
 
-template<class T, class Allocator>
-bool	operator==(const vector<T, Allocator> & lhs, const vector<T, Allocator> & rhs) {
+template<class T, class Allocator, class Growth>
+bool	operator==(const vector<T, Allocator, Growth> & lhs, const vector<T, Allocator, Growth> & rhs) {
 	if (lhs.size() != rhs.size())
 		return false;
-	return equal(lhs.begin(), lhs.end(), rhs.begin());
+	return ft::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template<class T, class Allocator>
-bool	operator!=(const vector<T, Allocator> & lhs, const vector<T, Allocator> & rhs) {
+template<class T, class Allocator, class Growth>
+bool	operator!=(const vector<T, Allocator, Growth> & lhs, const vector<T, Allocator, Growth> & rhs) {
 	return !(lhs == rhs);
 }
 
-template <class T, class Allocator>
-bool	operator<(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs) {
+template <class T, class Allocator, class Growth>
+bool	operator<(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs) {
 	return (ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()));
 }
 
-template <class T, class Allocator>
-bool	operator<=(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+template <class T, class Allocator, class Growth>
+bool	operator<=(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 {
 	return (!(rhs < lhs));
 }
 
-template <class T, class Allocator>
-bool	operator>(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+template <class T, class Allocator, class Growth>
+bool	operator>(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 {
 	return (rhs < lhs);
 }
 
-template <class T, class Allocator>
-bool	operator>=(const vector<T, Allocator>& lhs, const vector<T, Allocator>& rhs)
+template <class T, class Allocator, class Growth>
+bool	operator>=(const vector<T, Allocator, Growth>& lhs, const vector<T, Allocator, Growth>& rhs)
 {
 	return (!(lhs < rhs));
 }
 
 
 
-template<class T, class Allocator>
-void	vector<T, Allocator>::reserve( size_type new_cap )
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::reserve( size_type new_cap )
 {
 	// strong exception guarantee
 	if (new_cap > max_size())
 		throw std::length_error("vector");
-	if (new_cap > __capacity)
-	{
-		T * new_data = __alloc.allocate(new_cap);
-		size_type i;
-		try
-		{
-			for ( i = 0; i < __size; ++i)
-				__alloc.construct(new_data + i, __data[i]);
-		}
-		catch (...)
-		{
-			for (; i > 0; --i)
-				__alloc.destroy(new_data + i - 1);
-			__alloc.deallocate(new_data, new_cap);
-			throw ;
-		}
-		for (size_type i = 0; i < __size; ++i)
-			__alloc.destroy(__data + i);
-		__alloc.deallocate(__data, __capacity);
-		__data = new_data;
-		__capacity = new_cap;
-	}
+	if (new_cap > __capacity and not __resize_storage(new_cap))
+		__reallocate(__alloc.allocate(new_cap), new_cap);
 }
 
-template<class T, class Allocator>
-void	vector<T, Allocator>::resize( size_type count, T value)
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::shrink_to_fit()
 {
 	// strong exception guarantee
+	if (__capacity > __size and not __resize_storage(__size))
+		__reallocate(__alloc.allocate(__size), __size);
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::resize( size_type count, T value)
+{
 	if (count < __size)
 	{
-		for (size_type i = count; i < __size; ++i)
-			__alloc.destroy(__data + i);
+		__destroy(__data + count, __data + __size);
+		__size = count;
 	}
 	else if (count > __size)
+		insert(end(), count - __size, value);
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::resize_default_init( size_type count )
+{
+	if (count <= __size)
 	{
-		size_type old_size = __size;
-		for (size_type i = __size; i < count; ++i)
-		{
-			try
-			{
-				push_back(value);
-			}
-			catch (...)
-			{
-				for (size_type j = __size; j < i; ++j)
-					__alloc.destroy(__data + j);
-				__size = old_size;
-				throw ;
-			}
-		}
+		__destroy(__data + count, __data + __size);
+		__size = count;
+		return ;
 	}
+	if (count > __capacity)
+		reserve(__recommend(count));
+	__default_construct(__data + __size, count - __size);
 	__size = count;
 }
 
-template<class T, class Allocator>
-void	vector<T, Allocator>::swap( vector& other )
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::resize_uninitialized( size_type count )
+{
+	// doesn't compile for T that would need a constructor call
+	(void) sizeof(char[is_trivially_default_constructible<T>::value ? 1 : -1]);
+	resize_default_init(count);
+}
+
+template<class T, class Allocator, class Growth>
+template< class InputIt >
+void	vector<T, Allocator, Growth>::append(
+			typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+			InputIt last )
+{
+	// insert() at end() reserves once, doesn't move anything and copies
+	// contiguous trivially copyable ranges with memcpy
+	insert(end(), first, last);
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::append( const T* ptr, size_type n )
+{
+	insert(end(), ptr, ptr + n);
+}
+
+template<class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::swap( vector& other )
 {
 	std::swap(__data, other.__data);
 	std::swap(__capacity, other.__capacity);
 	std::swap(__size, other.__size);
 }
 
-template<class T, class Allocator>
-typename vector<T, Allocator>::size_type	vector<T, Allocator>::max_size() const
+template<class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::size_type	vector<T, Allocator, Growth>::max_size() const
 {
 	return (ft::min((size_type) std::numeric_limits<difference_type>::max(),
 						std::numeric_limits<size_type>::max() / sizeof(value_type)));
 }
 
 
-template <class T, class Allocator>
-class vector<T, Allocator>::iterator : public ft::iterator<std::random_access_iterator_tag, T>
+template <class T, class Allocator, class Growth>
+class vector<T, Allocator, Growth>::iterator : public ft::iterator<std::random_access_iterator_tag, T>
 {
 private:
 	T	* __ptr;
 public:
 	typedef T * iterator_type;
+	typedef contiguous_iterator_tag	iterator_concept;
 
 	iterator() {};
 	iterator(T * ptr) : __ptr(ptr) {};
@@ -644,49 +1038,49 @@ public:
 	T &		operator[](difference_type n) {
 		return *(__ptr + n);
 	}
-	operator vector<T, Allocator>::const_iterator() const {
-		return vector<T, Allocator>::const_iterator(__ptr);
+	operator vector<T, Allocator, Growth>::const_iterator() const {
+		return vector<T, Allocator, Growth>::const_iterator(__ptr);
 	}
 	
 	friend difference_type	operator-(
-		typename vector<T, Allocator>::iterator lhs,
-		typename vector<T, Allocator>::iterator rhs)
+		typename vector<T, Allocator, Growth>::iterator lhs,
+		typename vector<T, Allocator, Growth>::iterator rhs)
 	{
 		return lhs.base() - rhs.base();
 	}
 	friend bool operator==(
-		typename vector<T, Allocator>::iterator lhs,
-		typename  vector<T, Allocator>::iterator rhs)
+		typename vector<T, Allocator, Growth>::iterator lhs,
+		typename  vector<T, Allocator, Growth>::iterator rhs)
 	{
 		return lhs.base() == rhs.base();
 	}
 	friend bool operator<=(
-		typename vector<T, Allocator>::iterator lhs,
-		typename  vector<T, Allocator>::iterator rhs)
+		typename vector<T, Allocator, Growth>::iterator lhs,
+		typename  vector<T, Allocator, Growth>::iterator rhs)
 	{
 		return lhs.base() <= rhs.base();
 	}
 	friend bool operator>=(
-		typename vector<T, Allocator>::iterator lhs,
-		typename  vector<T, Allocator>::iterator rhs)
+		typename vector<T, Allocator, Growth>::iterator lhs,
+		typename  vector<T, Allocator, Growth>::iterator rhs)
 	{
 		return lhs.base() >= rhs.base();
 	}
 	friend bool operator!=(
-		typename vector<T, Allocator>::iterator lhs,
-		typename  vector<T, Allocator>::iterator rhs)
+		typename vector<T, Allocator, Growth>::iterator lhs,
+		typename  vector<T, Allocator, Growth>::iterator rhs)
 	{
 		return lhs.base() != rhs.base();
 	}
 	friend bool operator<(
-		typename vector<T, Allocator>::iterator lhs,
-		typename  vector<T, Allocator>::iterator rhs)
+		typename vector<T, Allocator, Growth>::iterator lhs,
+		typename  vector<T, Allocator, Growth>::iterator rhs)
 	{
 		return lhs.base() < rhs.base();
 	}
 	friend bool operator>(
-		typename vector<T, Allocator>::iterator lhs,
-		typename  vector<T, Allocator>::iterator rhs)
+		typename vector<T, Allocator, Growth>::iterator lhs,
+		typename  vector<T, Allocator, Growth>::iterator rhs)
 	{
 		return lhs.base() > rhs.base();
 	}
@@ -695,14 +1089,15 @@ public:
 
 
 
-template <class T, class Allocator>
-class vector<T, Allocator>::const_iterator : 
+template <class T, class Allocator, class Growth>
+class vector<T, Allocator, Growth>::const_iterator : 
 	public ft::iterator<std::random_access_iterator_tag, T, std::ptrdiff_t, const T*, const T&>
 {
 private:
 	const T	* __ptr;
 public:
 	typedef const T * iterator_type;
+	typedef contiguous_iterator_tag	iterator_concept;
 
 	const_iterator() {};
 	const_iterator(const T * ptr) : __ptr(ptr) {};
@@ -761,44 +1156,44 @@ public:
 	}
 	
 	friend difference_type	operator-(
-		typename vector<T, Allocator>::const_iterator lhs,
-		typename vector<T, Allocator>::const_iterator rhs)
+		typename vector<T, Allocator, Growth>::const_iterator lhs,
+		typename vector<T, Allocator, Growth>::const_iterator rhs)
 	{
-		return lhs.base() - rhs.rhs();
+		return lhs.base() - rhs.base();
 	}
 	friend bool operator==(
-		typename vector<T, Allocator>::const_iterator lhs,
-		typename  vector<T, Allocator>::const_iterator rhs)
+		typename vector<T, Allocator, Growth>::const_iterator lhs,
+		typename  vector<T, Allocator, Growth>::const_iterator rhs)
 	{
 		return lhs.base() == rhs.base();
 	}
 	friend bool operator<=(
-		typename vector<T, Allocator>::const_iterator lhs,
-		typename  vector<T, Allocator>::const_iterator rhs)
+		typename vector<T, Allocator, Growth>::const_iterator lhs,
+		typename  vector<T, Allocator, Growth>::const_iterator rhs)
 	{
 		return lhs.base() <= rhs.base();
 	}
 	friend bool operator>=(
-		typename vector<T, Allocator>::const_iterator lhs,
-		typename  vector<T, Allocator>::const_iterator rhs)
+		typename vector<T, Allocator, Growth>::const_iterator lhs,
+		typename  vector<T, Allocator, Growth>::const_iterator rhs)
 	{
 		return lhs.base() >= rhs.base();
 	}
 	friend bool operator!=(
-		typename vector<T, Allocator>::const_iterator lhs,
-		typename  vector<T, Allocator>::const_iterator rhs)
+		typename vector<T, Allocator, Growth>::const_iterator lhs,
+		typename  vector<T, Allocator, Growth>::const_iterator rhs)
 	{
 		return lhs.base() != rhs.base();
 	}
 	friend bool operator<(
-		typename vector<T, Allocator>::const_iterator lhs,
-		typename  vector<T, Allocator>::const_iterator rhs)
+		typename vector<T, Allocator, Growth>::const_iterator lhs,
+		typename  vector<T, Allocator, Growth>::const_iterator rhs)
 	{
 		return lhs.base() < rhs.base();
 	}
 	friend bool operator>(
-		typename vector<T, Allocator>::const_iterator lhs,
-		typename  vector<T, Allocator>::const_iterator rhs)
+		typename vector<T, Allocator, Growth>::const_iterator lhs,
+		typename  vector<T, Allocator, Growth>::const_iterator rhs)
 	{
 		return lhs.base() > rhs.base();
 	}
@@ -806,406 +1201,263 @@ public:
 
 
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator		vector<T, Allocator>::begin()
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::iterator		vector<T, Allocator, Growth>::begin()
 {
 	return __data;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator		vector<T, Allocator>::end()
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::iterator		vector<T, Allocator, Growth>::end()
 {
 	return __data + __size;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_iterator		vector<T, Allocator>::begin() const
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_iterator		vector<T, Allocator, Growth>::begin() const
 {
 	return __data;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_iterator		vector<T, Allocator>::end() const
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_iterator		vector<T, Allocator, Growth>::end() const
 {
 	return __data + __size;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reverse_iterator		vector<T, Allocator>::rbegin()
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::reverse_iterator		vector<T, Allocator, Growth>::rbegin()
 {
 	return reverse_iterator(end());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reverse_iterator		vector<T, Allocator>::rbegin() const
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_reverse_iterator		vector<T, Allocator, Growth>::rbegin() const
 {
 	return const_reverse_iterator(end());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::reverse_iterator		vector<T, Allocator>::rend()
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::reverse_iterator		vector<T, Allocator, Growth>::rend()
 {
 	return reverse_iterator(begin());
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::const_reverse_iterator		vector<T, Allocator>::rend() const
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::const_reverse_iterator		vector<T, Allocator, Growth>::rend() const
 {
 	return const_reverse_iterator(begin());
 }
 
 
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator		vector<T, Allocator>::insert(
-		typename vector<T, Allocator>::iterator pos, const T& value )
-{	
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::iterator		vector<T, Allocator, Growth>::insert(
+		typename vector<T, Allocator, Growth>::iterator pos, const T& value )
+{
+	size_type n = pos - begin();
 	if (__size == __capacity)
 	{
 		// strong exception guarantee
-		T * tmp = __alloc.allocate(__size << 1);
-		size_type count = pos - begin();
-		size_type i;
+		size_type	new_cap = __recommend(__size + 1);
+		T * tmp = __alloc.allocate(new_cap);
 		try
 		{
-			for ( i = 0; i < count; ++i)
-				__alloc.construct(tmp + count, __data[i]);
-			__alloc.construct(tmp + count, value);
+			__alloc.construct(tmp + n, value);
 		}
 		catch (...)
 		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, __size * 2);
+			__alloc.deallocate(tmp, new_cap);
 			throw ;
 		}
+		__reallocate(tmp, new_cap, n, 1);
+		__size++;
+		return iterator(__data + n);
+	}
+	// basic exception guarantee
+	// value may live inside the vector, keep a copy before shifting
+	T copy(value);
+	__open_gap(n, 1);
+	try
+	{
+		__alloc.construct(__data + n, FT_MOVE(copy));
+	}
+	catch (...)
+	{
+		__destroy(__data, __data + n);
+		__destroy(__data + n + 1, __data + __size + 1);
+		__size = 0;
+		throw ;
+	}
+	__size++;
+	return iterator(__data + n); 
+}
+
+# if FT_CXX11
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::iterator		vector<T, Allocator, Growth>::insert(
+		typename vector<T, Allocator, Growth>::iterator pos, T&& value )
+{
+	return emplace(pos, std::move(value));
+}
+
+template <class T, class Allocator, class Growth>
+template< class... Args >
+typename vector<T, Allocator, Growth>::iterator		vector<T, Allocator, Growth>::emplace(
+		typename vector<T, Allocator, Growth>::iterator pos, Args&&... args )
+{
+	size_type n = pos - begin();
+	if (n == __size)
+	{
+		emplace_back(std::forward<Args>(args)...);
+		return iterator(__data + n);
+	}
+	if (__size == __capacity)
+	{
+		// strong exception guarantee
+		size_type	new_cap = __recommend(__size + 1);
+		T * tmp = __alloc.allocate(new_cap);
 		try
 		{
-			for ( i = count; i < __size; ++i)
-				__alloc.construct(tmp + i + 1, __data[i]);
+			__alloc.construct(tmp + n, std::forward<Args>(args)...);
 		}
 		catch (...)
 		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, __size * 2);
+			__alloc.deallocate(tmp, new_cap);
 			throw ;
 		}
-		for (size_type i = 0; i < __size; ++i)
-			__alloc.destroy(__data + i);
-		__alloc.deallocate(__data, __capacity);
-		__data = tmp;
-		__capacity <<= 1;
+		__reallocate(tmp, new_cap, n, 1);
 		__size++;
-		return vector<T, Allocator>::iterator(__data + count);
+		return iterator(__data + n);
 	}
 	// basic exception guarantee
-	size_type count = pos - begin();
-	if (__size != 0)
-	{
-		size_type i = __size;
-		for (; i > count; --i)
-		{
-			try
-			{
-				__alloc.construct(__data + i, *(__data - 1 + i));
-			}
-			catch (...)
-			{
-				for (size_type j = 0; j < i; ++j)
-					__alloc.destroy(__data + j);
-				for (size_type j = i + 1; j < __size + 1; j++)
-					__alloc.destroy(__data + j);
-				__size = 0;
-				throw ;
-			}
-			__alloc.destroy(__data - 1 + i);
-		}
-	}
+	T value(std::forward<Args>(args)...);
+	__open_gap(n, 1);
 	try
 	{
-		__alloc.construct(__data + count, value);
+		__alloc.construct(__data + n, std::move(value));
 	}
 	catch (...)
 	{
-		for (size_type i = 0; i < count; ++i)
-			__alloc.destroy(__data + i);
-		for (size_type i = count + 1; i < __size + 1; ++i)
-			__alloc.destroy(__data + i);
+		__destroy(__data, __data + n);
+		__destroy(__data + n + 1, __data + __size + 1);
 		__size = 0;
 		throw ;
 	}
 	__size++;
-	return vector<T, Allocator>::iterator(__data + count); 
+	return iterator(__data + n);
 }
+# endif
 
-template <class T, class Allocator>
-void	vector<T, Allocator>::insert(
-		typename vector<T, Allocator>::iterator pos,
+template <class T, class Allocator, class Growth>
+void	vector<T, Allocator, Growth>::insert(
+		typename vector<T, Allocator, Growth>::iterator pos,
 		size_type count, const T& value )
 {
+	if (count == 0)
+		return ;
+	size_type n = pos - begin();
 	if (__size + count > __capacity)
 	{
 		// strong exception guarantee
-		size_type	new_capacity = __capacity * 2;
-		if (new_capacity < __capacity + count)
-			new_capacity = count + __capacity;
-		T * tmp = __alloc.allocate(new_capacity);
-		size_type n = pos - begin();
-		size_type i;
+		size_type	new_cap = __recommend(__size + count);
+		T * tmp = __alloc.allocate(new_cap);
 		try
 		{
-			for ( i = 0; i < n; ++i)
-				__alloc.construct(tmp + i, __data[i]);
+			__fill_construct(tmp + n, count, value);
 		}
 		catch (...)
 		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, new_capacity);
+			__alloc.deallocate(tmp, new_cap);
 			throw ;
 		}
-		try
-		{
-			for ( i = n; i < n + count; ++i)
-				__alloc.construct(tmp + i, value);
-		}
-		catch (...)
-		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, new_capacity);
-			throw ;
-		}
-		try
-		{
-			for ( i = n + count; i < __size + count; ++i)
-				__alloc.construct(tmp + i, __data[i - count]);
-		}
-		catch (...)
-		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, new_capacity);
-			throw ;
-		}
-		size_type _tmp = __size;
-		this->clear_all();
-		__capacity = new_capacity;
-		__size = _tmp + count;
-		__data = tmp;
+		__reallocate(tmp, new_cap, n, count);
+		__size += count;
 		return ;
 	}
 	// basic exception guarantee
-	size_type n = pos - begin();
-	if (__size != 0)
+	T copy(value);
+	__open_gap(n, count);
+	try
 	{
-		size_type i = __size - 1;
-		for (; i >= n; --i)
-		{
-			try
-			{
-				__alloc.construct(__data + i + count, __data[i]);
-			}
-			catch (...)
-			{
-				for (size_type j = 0; j <= i; ++j)
-					__alloc.destroy(__data + j);
-				for (size_type j = i + count + 1; j < __size + count ; ++j)
-					__alloc.destroy(__data + j);
-				__size = 0;
-				throw ;
-			}
-			__alloc.destroy(__data + i);
-		}
+		__fill_construct(__data + n, count, copy);
 	}
-	size_type i = 0;
-	for (; i < count; ++i)
+	catch (...)
 	{
-		try
-		{
-			__alloc.construct(__data + n + i, value);
-		}
-		catch (...)
-		{
-			for (size_type j = 0; j < n + i; ++j)
-				__alloc.destroy(__data + j);
-			for (size_type j = n + count; j < __size + count; ++j)
-				__alloc.destroy(__data + j);
-			__size = 0;
-			throw ;
-		}
+		__destroy(__data, __data + n);
+		__destroy(__data + n + count, __data + __size + count);
+		__size = 0;
+		throw ;
 	}
 	__size += count;
 }
 	
 
 
-template <class T, class Allocator>
+template <class T, class Allocator, class Growth>
 template< class InputIt >
-void	vector<T, Allocator>::insert(
-		typename vector<T, Allocator>::iterator pos,
+void	vector<T, Allocator, Growth>::insert(
+		typename vector<T, Allocator, Growth>::iterator pos,
 		typename enable_if<is_iterator<InputIt>::value,
 		InputIt>::type first, InputIt last)
 {
 	size_type count = ft::distance(first, last);
+	if (count == 0)
+		return ;
+	size_type n = pos - begin();
 	if (__size + count > __capacity)
 	{
 		// strong exception guarantee
-		size_type	new_capacity = __capacity * 2;
-		if (new_capacity < __capacity + count)
-			new_capacity = count + __capacity;
-		T * tmp = __alloc.allocate(new_capacity);
-		size_type n = pos - begin();
-		
-		size_type i = 0;
-		try 
-		{
-			for ( i = 0; i < n; ++i)
-				__alloc.construct(tmp + i, __data[i]);
-		}
-		catch (...)
-		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, new_capacity);
-			throw ;
-		}
+		size_type	new_cap = __recommend(__size + count);
+		T * tmp = __alloc.allocate(new_cap);
 		try
 		{
-			for ( i = n; i < n + count; ++i, ++first)
-				__alloc.construct(tmp + i, *first);
+			__copy_construct(tmp + n, first, last);
 		}
 		catch (...)
 		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, new_capacity);
+			__alloc.deallocate(tmp, new_cap);
 			throw ;
 		}
-		try
-		{
-			for ( i = n + count; i < __size + count; ++i)
-				__alloc.construct(tmp + i, __data[i - count]);
-		}
-		catch (...)
-		{
-			for ( ; i > 0; --i)
-				__alloc.destroy(tmp + i - 1);
-			__alloc.deallocate(tmp, new_capacity);
-			throw ;
-		}
-		size_type _tmp = __size;
-		clear_all();
-		__capacity = new_capacity;
-		__size = _tmp + count;
-		__data = tmp;
+		__reallocate(tmp, new_cap, n, count);
+		__size += count;
 		return ;
 	}
 	// basic exception guarantee
-	size_type n = pos - begin();
-	if (__size != 0)
+	__open_gap(n, count);
+	try
 	{
-		size_type i = __size - 1;
-		for (; i >= n; --i)
-		{
-			try
-			{
-				__alloc.construct(__data + i + count, __data[i]);
-			}
-			catch (...)
-			{
-				for (size_type j = 0; j <= i; ++j)
-					__alloc.destroy(__data + j);
-				for (size_type j = i + count + 1; j < __size + count ; ++j)
-					__alloc.destroy(__data + j);
-				__size = 0;
-				throw ;
-			}
-			__alloc.destroy(__data + i);
-		}
+		__copy_construct(__data + n, first, last);
 	}
-	size_type i = 0;
-	for (; i < count; ++i, ++first)
+	catch (...)
 	{
-		try
-		{
-			__alloc.construct(__data + n + i, *first);
-		}
-		catch (...)
-		{
-			for (size_type j = 0; j < n + i; ++j)
-				__alloc.destroy(__data + j);
-			for (size_type j = n + count; j < __size + count; ++j)
-				__alloc.destroy(__data + j);
-			__size = 0;
-			throw ;
-		}
+		__destroy(__data, __data + n);
+		__destroy(__data + n + count, __data + __size + count);
+		__size = 0;
+		throw ;
 	}
 	__size += count;
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(
-		typename vector<T, Allocator>::iterator pos)
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::iterator vector<T, Allocator, Growth>::erase(
+		typename vector<T, Allocator, Growth>::iterator pos)
 {
-	// basic exception guarantee
-	size_type n = pos - begin();
-	for (size_type i = n; i + 1 < __size; ++i)
-	{
-		__alloc.destroy(__data + i);
-		try
-		{
-			__alloc.construct(__data + i, __data[i + 1]);
-		}
-		catch (...)
-		{
-			for (size_type j = 0; j < i; ++j)
-				__alloc.destroy(__data + j);
-			for (size_type j = i + 1; j < __size; ++j)
-				__alloc.destroy(__data + j);
-			__size = 0;
-			throw ;
-		}
-	}
-	__alloc.destroy(__data + __size - 1);
-	if (n == __size)
-		n--;
-	__size--;
-	return iterator(__data + n);
+	return erase(pos, pos + 1);
 }
 
-template <class T, class Allocator>
-typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(
-			typename vector<T, Allocator>::iterator first,
-			typename vector<T, Allocator>::iterator last)
+template <class T, class Allocator, class Growth>
+typename vector<T, Allocator, Growth>::iterator vector<T, Allocator, Growth>::erase(
+			typename vector<T, Allocator, Growth>::iterator first,
+			typename vector<T, Allocator, Growth>::iterator last)
 {
 	// basic exception guarantee
 	size_type n = first - begin();
 	size_type count = last - first;
 	if (count == 0)
 		return last;
-	for (size_type i = 0; i < count; ++i)
-		__alloc.destroy(__data + n + i);
-	for (size_type i = n + count; i < __size; ++i)
-	{
-		try
-		{
-			__alloc.construct(__data + i - count, __data[i]);
-		}
-		catch (...)
-		{
-			for (size_type j = 0; j < i - count; ++j)
-				__alloc.destroy(__data + j);
-			for (size_type j = i; j < __size; ++j)
-				__alloc.destroy(__data + j);
-			__size = 0;
-			throw ;
-		}
-		__alloc.destroy(__data + i);
-	}
-	if (last == end())
-		n = __size - count;
+	__destroy(__data + n, __data + n + count);
+	__close_gap(n, count);
 	__size -= count;
 	return iterator(__data + n);
 }
@@ -1216,12 +1468,15 @@ typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(
 
 namespace std
 {
-	template <class T, class Allocator>
-	void	swap( ft::vector<T, Allocator> & lhs,
-				ft::vector<T, Allocator> & rhs)
+	template <class T, class Allocator, class Growth>
+	void	swap( ft::vector<T, Allocator, Growth> & lhs,
+				ft::vector<T, Allocator, Growth> & rhs)
 	{
 		lhs.swap(rhs);
 	}
 }
 
+# include "incremental_vector.hpp"
+# include "vector_bool.hpp"
+
 #endif // FT_VECTOR_HPP
@@ -0,0 +1,715 @@
+/* ************************************************************************** */
+/*                                                                            */
+/*                                                        :::      ::::::::   */
+/*   vector_bool.hpp                                    :+:      :+:    :+:   */
+/*                                                    +:+ +:+         +:+     */
+/*   By: marmand <marmand@student.42.fr>            +#+  +:+       +#+        */
+/*                                                +#+#+#+#+#+   +#+           */
+/*   Created: 2026/10/20 00:41:17 by marmand           #+#    #+#             */
+/*   Updated: 2026/10/20 00:41:17 by marmand          ###   ########.fr       */
+/*                                                                            */
+/* ************************************************************************** */
+
+#ifndef FT_VECTOR_BOOL_HPP
+# define FT_VECTOR_BOOL_HPP
+
+# include <memory>
+# include <cstddef>
+# include <cstring>
+# include <limits>
+# include <stdexcept>
+# include <stdint.h>
+# include "utility.hpp"
+# include "simd.hpp"
+# include "vector.hpp"
+
+namespace ft
+{
+
+namespace detail
+{
+	typedef uint64_t	__bit_word;
+
+	static const std::size_t	__bits_per_word = 64;
+
+	inline std::size_t	__words_for( std::size_t bits )
+	{ return (bits + __bits_per_word - 1) / __bits_per_word; }
+}
+
+// Proxy for one bit of a vector<bool>: the word it lives in and its mask.
+class bit_reference
+{
+public:
+	bit_reference( detail::__bit_word * word, detail::__bit_word mask ) :
+		__word(word), __mask(mask) {}
+
+	bit_reference( const bit_reference & other ) :
+		__word(other.__word), __mask(other.__mask) {}
+
+	operator bool() const
+	{ return (*__word & __mask) != 0; }
+
+	bool	operator~() const
+	{ return (*__word & __mask) == 0; }
+
+	bit_reference &	operator=( bool value )
+	{
+		if (value)
+			*__word |= __mask;
+		else
+			*__word &= ~__mask;
+		return *this;
+	}
+
+	bit_reference &	operator=( const bit_reference & other )
+	{ return *this = bool(other); }
+
+	void	flip()
+	{ *__word ^= __mask; }
+
+private:
+	detail::__bit_word	*__word;
+	detail::__bit_word	__mask;
+};
+
+inline void	swap( bit_reference a, bit_reference b )
+{
+	bool	tmp = a;
+	a = bool(b);
+	b = tmp;
+}
+
+// Random access iterator over the bits: a word and a bit index in it.
+// Dereferences to a bit_reference, or to a bool when Const.
+template <bool Const>
+class bit_iterator :
+	public ft::iterator<std::random_access_iterator_tag, bool, std::ptrdiff_t, void,
+						typename conditional<Const, bool, bit_reference>::type>
+{
+private:
+	typedef typename conditional<Const, const detail::__bit_word,
+								detail::__bit_word>::type	__word_type;
+
+	__word_type		*__word;
+	std::size_t		__bit;
+public:
+	typedef std::ptrdiff_t												difference_type;
+	typedef typename conditional<Const, bool, bit_reference>::type		reference;
+
+	bit_iterator() : __word(NULL), __bit(0) {}
+	bit_iterator( __word_type * word, std::size_t bit ) : __word(word), __bit(bit) {}
+	bit_iterator( const bit_iterator<false> & other ) :
+		__word(other.__base()), __bit(other.__offset()) {}
+
+	__word_type *	__base() const {
+		return __word;
+	}
+	std::size_t	__offset() const {
+		return __bit;
+	}
+	reference	operator*() const {
+		return __deref(integral_constant<bool, Const>());
+	}
+	reference	operator[]( difference_type n ) const {
+		return *(*this + n);
+	}
+	bit_iterator &	operator++() {
+		if (++__bit == detail::__bits_per_word)
+		{
+			__bit = 0;
+			++__word;
+		}
+		return *this;
+	}
+	bit_iterator	operator++(int) {
+		bit_iterator tmp(*this);
+		++*this;
+		return tmp;
+	}
+	bit_iterator &	operator--() {
+		if (__bit-- == 0)
+		{
+			__bit = detail::__bits_per_word - 1;
+			--__word;
+		}
+		return *this;
+	}
+	bit_iterator	operator--(int) {
+		bit_iterator tmp(*this);
+		--*this;
+		return tmp;
+	}
+	bit_iterator &	operator+=( difference_type n ) {
+		difference_type	pos = static_cast<difference_type>(__bit) + n;
+		// floor division, pos may be negative
+		difference_type	words = pos >= 0 ? pos / 64 : -((63 - pos) / 64);
+		__word += words;
+		__bit = pos - words * 64;
+		return *this;
+	}
+	bit_iterator &	operator-=( difference_type n ) {
+		return *this += -n;
+	}
+	bit_iterator	operator+( difference_type n ) const {
+		bit_iterator tmp(*this);
+		return tmp += n;
+	}
+	bit_iterator	operator-( difference_type n ) const {
+		bit_iterator tmp(*this);
+		return tmp += -n;
+	}
+
+	friend bit_iterator	operator+( difference_type n, bit_iterator it )
+	{ return it + n; }
+	friend difference_type	operator-( bit_iterator lhs, bit_iterator rhs )
+	{
+		return (lhs.__word - rhs.__word) * 64
+				+ static_cast<difference_type>(lhs.__bit) - static_cast<difference_type>(rhs.__bit);
+	}
+	friend bool operator==( bit_iterator lhs, bit_iterator rhs )
+	{ return lhs.__word == rhs.__word and lhs.__bit == rhs.__bit; }
+	friend bool operator!=( bit_iterator lhs, bit_iterator rhs )
+	{ return not (lhs == rhs); }
+	friend bool operator<( bit_iterator lhs, bit_iterator rhs )
+	{ return lhs - rhs < 0; }
+	friend bool operator>( bit_iterator lhs, bit_iterator rhs )
+	{ return rhs < lhs; }
+	friend bool operator<=( bit_iterator lhs, bit_iterator rhs )
+	{ return not (rhs < lhs); }
+	friend bool operator>=( bit_iterator lhs, bit_iterator rhs )
+	{ return not (lhs < rhs); }
+
+private:
+	bool	__deref( true_type ) const
+	{ return (*__word >> __bit) & 1; }
+
+	bit_reference	__deref( false_type ) const
+	{
+		return bit_reference(const_cast<detail::__bit_word *>(__word),
+							detail::__bit_word(1) << __bit);
+	}
+};
+
+// vector<bool> stores one bit per element in 64 bit words, 8 times less
+// memory than a byte per flag. operator[] returns a bit_reference proxy,
+// and data() gives the words: bit i is bit i % 64 of word i / 64, the
+// bits past size() in the last word are always 0.
+// count, find_first / find_next and the &=, |=, ^= between vectors of the
+// same size work a word at a time (POPCNT, TZCNT, SSE2 / AVX2).
+// Growth is computed in words with the Growth policy.
+template< class Allocator, class Growth >
+class vector<bool, Allocator, Growth>
+{
+public:
+	typedef bool										value_type;
+	typedef Allocator									allocator_type;
+	typedef Growth										growth_policy;
+	typedef std::size_t									size_type;
+	typedef std::ptrdiff_t								difference_type;
+	typedef bit_reference								reference;
+	typedef bool										const_reference;
+	typedef detail::__bit_word							word_type;
+
+	typedef bit_iterator<false>							iterator;
+	typedef bit_iterator<true>							const_iterator;
+	typedef ft::reverse_iterator<iterator>				reverse_iterator;
+	typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	// returned by find_first and find_next when there is no set bit
+	static const size_type	npos = static_cast<size_type>(-1);
+
+	vector() :
+		__words(NULL), __size(0), __capacity(0), __alloc()
+	{}
+
+	explicit vector( const Allocator& alloc ) :
+		__words(NULL), __size(0), __capacity(0), __alloc(alloc)
+	{}
+
+	explicit vector( size_type count, const bool& value = false,
+					const Allocator& alloc = Allocator() ) :
+		__words(NULL), __size(0), __capacity(0), __alloc(alloc)
+	{ assign(count, value); }
+
+	template< class InputIt >
+	vector( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+			InputIt last, const Allocator& alloc = Allocator() ) :
+		__words(NULL), __size(0), __capacity(0), __alloc(alloc)
+	{
+		try
+		{
+			assign(first, last);
+		}
+		catch (...)
+		{
+			__release();
+			throw ;
+		}
+	}
+
+	vector( const vector& other ) :
+		__words(NULL), __size(0), __capacity(0), __alloc(other.__alloc)
+	{ *this = other; }
+
+	~vector()
+	{ __release(); }
+
+	vector& operator=( const vector& other )
+	{
+		if (this == &other)
+			return *this;
+		size_type	words = detail::__words_for(other.__size);
+		if (words > __capacity)
+		{
+			__word_pointer	tmp = __alloc.allocate(words);
+			__release();
+			__words = tmp;
+			__capacity = words;
+		}
+		if (words != 0)
+			std::memcpy(__words, other.__words, words * sizeof(word_type));
+		__size = other.__size;
+		return *this;
+	}
+
+# if FT_CXX11
+	vector( vector&& other ) noexcept :
+		__words(other.__words), __size(other.__size), __capacity(other.__capacity),
+		__alloc(other.__alloc)
+	{
+		other.__words = NULL;
+		other.__size = 0;
+		other.__capacity = 0;
+	}
+
+	vector& operator=( vector&& other )
+	{
+		if (this != &other)
+		{
+			if (!(__alloc == other.__alloc))
+			{
+				// the words can't change owner, copy them
+				*this = static_cast<const vector &>(other);
+				other.clear();
+				return *this;
+			}
+			__release();
+			__words = other.__words;
+			__size = other.__size;
+			__capacity = other.__capacity;
+			other.__words = NULL;
+			other.__size = 0;
+			other.__capacity = 0;
+		}
+		return *this;
+	}
+# endif
+
+	void assign( size_type count, const bool& value )
+	{
+		clear();
+		resize(count, value);
+	}
+
+	template< class InputIt >
+	void assign( typename enable_if<is_iterator<InputIt>::value, InputIt>::type first,
+				InputIt last )
+	{
+		clear();
+		for (; first != last; ++first)
+			push_back(*first);
+	}
+
+	allocator_type get_allocator() const
+	{ return __alloc; }
+
+	reference at( size_type pos )
+	{
+		if (pos >= __size)
+			throw std::out_of_range("vector");
+		return (*this)[pos];
+	}
+
+	const_reference at( size_type pos ) const
+	{
+		if (pos >= __size)
+			throw std::out_of_range("vector");
+		return (*this)[pos];
+	}
+
+	reference operator[]( size_type pos )
+	{
+		return reference(__words + pos / detail::__bits_per_word,
+						word_type(1) << (pos % detail::__bits_per_word));
+	}
+
+	const_reference operator[]( size_type pos ) const
+	{ return (__words[pos / detail::__bits_per_word] >> (pos % detail::__bits_per_word)) & 1; }
+
+	reference front()
+	{ return (*this)[0]; }
+
+	const_reference front() const
+	{ return (*this)[0]; }
+
+	reference back()
+	{ return (*this)[__size - 1]; }
+
+	const_reference back() const
+	{ return (*this)[__size - 1]; }
+
+	// the words, size_words() of them
+	word_type* data()
+	{ return __words; }
+
+	const word_type* data() const
+	{ return __words; }
+
+	size_type size_words() const
+	{ return detail::__words_for(__size); }
+
+	iterator begin()
+	{ return iterator(__words, 0); }
+
+	const_iterator begin() const
+	{ return const_iterator(__words, 0); }
+
+	iterator end()
+	{ return begin() + __size; }
+
+	const_iterator end() const
+	{ return begin() + __size; }
+
+	reverse_iterator rbegin()
+	{ return reverse_iterator(end()); }
+
+	const_reverse_iterator rbegin() const
+	{ return const_reverse_iterator(end()); }
+
+	reverse_iterator rend()
+	{ return reverse_iterator(begin()); }
+
+	const_reverse_iterator rend() const
+	{ return const_reverse_iterator(begin()); }
+
+	bool empty() const
+	{ return __size == 0; }
+
+	size_type size() const
+	{ return __size; }
+
+	size_type max_size() const
+	{
+		size_type	words = __alloc.max_size();
+		if (words > std::numeric_limits<size_type>::max() / detail::__bits_per_word)
+			return std::numeric_limits<size_type>::max();
+		return words * detail::__bits_per_word;
+	}
+
+	size_type capacity() const
+	{ return __capacity * detail::__bits_per_word; }
+
+	void reserve( size_type new_cap )
+	{
+		if (new_cap > max_size())
+			throw std::length_error("vector");
+		size_type	words = detail::__words_for(new_cap);
+		if (words > __capacity)
+			__reallocate(words);
+	}
+
+	void shrink_to_fit()
+	{
+		size_type	words = detail::__words_for(__size);
+		if (words == __capacity)
+			return ;
+		if (words == 0)
+			__release();
+		else
+			__reallocate(words);
+	}
+
+	void clear()
+	{ __size = 0; }
+
+	void push_back( bool value )
+	{
+		if (__size == capacity())
+			__reallocate(__recommend(detail::__words_for(__size + 1)));
+		word_type	&word = __words[__size / detail::__bits_per_word];
+		if (__size % detail::__bits_per_word == 0)
+			word = 0;
+		word |= word_type(value) << (__size % detail::__bits_per_word);
+		++__size;
+	}
+
+# if FT_CXX11
+	template< class... Args >
+	void emplace_back( Args&&... args )
+	{ push_back(bool(std::forward<Args>(args)...)); }
+# endif
+
+	void pop_back()
+	{
+		--__size;
+		__words[__size / detail::__bits_per_word] &= ~(word_type(1) << (__size % detail::__bits_per_word));
+	}
+
+	void resize( size_type count, bool value = false )
+	{
+		if (count <= __size)
+		{
+			__size = count;
+			__clear_tail();
+			return ;
+		}
+		size_type	words = detail::__words_for(count);
+		if (words > __capacity)
+			__reallocate(__recommend(words));
+		// the tail of the last word is 0 already
+		size_type	first_word = detail::__words_for(__size);
+		if (value)
+		{
+			if (__size % detail::__bits_per_word != 0)
+				__words[first_word - 1] |= ~word_type(0) << (__size % detail::__bits_per_word);
+			std::memset(__words + first_word, 0xff, (words - first_word) * sizeof(word_type));
+		}
+		else
+			std::memset(__words + first_word, 0, (words - first_word) * sizeof(word_type));
+		__size = count;
+		__clear_tail();
+	}
+
+	// the allocators are not exchanged, they must compare equal
+	void swap( vector& other )
+	{
+		ft::swap(__words, other.__words);
+		ft::swap(__size, other.__size);
+		ft::swap(__capacity, other.__capacity);
+	}
+
+	static void swap( reference a, reference b )
+	{ ft::swap(a, b); }
+
+	// inverts every bit
+	void flip()
+	{
+		size_type	words = detail::__words_for(__size);
+		for (size_type i = 0; i != words; ++i)
+			__words[i] = ~__words[i];
+		__clear_tail();
+	}
+
+	iterator insert( const_iterator pos, bool value )
+	{
+		size_type	at = pos - begin();
+		insert(pos, 1, value);
+		return begin() + at;
+	}
+
+	// bit by bit after pos
+	iterator insert( const_iterator pos, size_type count, bool value )
+	{
+		size_type	at = pos - begin();
+		size_type	old_size = __size;
+		resize(__size + count);
+		for (size_type i = old_size; i > at; --i)
+			(*this)[i - 1 + count] = (*this)[i - 1];
+		for (size_type i = at; i != at + count; ++i)
+			(*this)[i] = value;
+		return begin() + at;
+	}
+
+	template< class InputIt >
+	iterator insert( const_iterator pos, typename enable_if<is_iterator<InputIt>::value,
+						InputIt>::type first, InputIt last )
+	{
+		size_type	at = pos - begin();
+		vector		tail(begin() + at, end());
+		resize(at);
+		for (; first != last; ++first)
+			push_back(*first);
+		for (size_type i = 0; i != tail.size(); ++i)
+			push_back(tail[i]);
+		return begin() + at;
+	}
+
+	iterator erase( const_iterator pos )
+	{ return erase(pos, pos + 1); }
+
+	iterator erase( const_iterator first, const_iterator last )
+	{
+		size_type	at = first - begin();
+		size_type	count = last - first;
+		for (size_type i = at; i + count < __size; ++i)
+			(*this)[i] = (*this)[i + count];
+		resize(__size - count);
+		return begin() + at;
+	}
+
+	// number of set bits
+	size_type count() const
+	{ return detail::__popcount_words(__words, detail::__words_for(__size)); }
+
+	bool any() const
+	{ return find_first() != npos; }
+
+	bool none() const
+	{ return find_first() == npos; }
+
+	// index of the first set bit, npos if there is none
+	size_type find_first() const
+	{ return __find_from(0); }
+
+	// index of the first set bit after pos, npos if there is none
+	size_type find_next( size_type pos ) const
+	{
+		++pos;
+		if (pos >= __size)
+			return npos;
+		size_type	w = pos / detail::__bits_per_word;
+		word_type	word = __words[w] >> (pos % detail::__bits_per_word);
+		if (word != 0)
+			return pos + __builtin_ctzll(word);
+		return __find_from(w + 1);
+	}
+
+	// bitwise operations with a vector of the same size
+	vector& operator&=( const vector& other )
+	{
+		__check_size(other);
+		detail::__bitwise_words<0>(__words, other.__words, detail::__words_for(__size));
+		return *this;
+	}
+
+	vector& operator|=( const vector& other )
+	{
+		__check_size(other);
+		detail::__bitwise_words<1>(__words, other.__words, detail::__words_for(__size));
+		return *this;
+	}
+
+	vector& operator^=( const vector& other )
+	{
+		__check_size(other);
+		detail::__bitwise_words<2>(__words, other.__words, detail::__words_for(__size));
+		return *this;
+	}
+
+private:
+	typedef typename Allocator::template rebind<word_type>::other	__word_allocator;
+	typedef word_type *												__word_pointer;
+
+	size_type	__recommend( size_type words ) const
+	{
+		if (words > __alloc.max_size())
+			throw std::length_error("vector");
+		size_type	cap = Growth::next(__capacity, words, sizeof(word_type));
+		if (cap < words)
+			return words;
+		return ft::min(cap, __alloc.max_size());
+	}
+
+	void	__reallocate( size_type words )
+	{
+		__word_pointer	tmp = __alloc.allocate(words);
+		size_type		used = ft::min(detail::__words_for(__size), words);
+		if (used != 0)
+			std::memcpy(tmp, __words, used * sizeof(word_type));
+		if (__words != NULL)
+			__alloc.deallocate(__words, __capacity);
+		__words = tmp;
+		__capacity = words;
+	}
+
+	void	__release()
+	{
+		if (__words != NULL)
+			__alloc.deallocate(__words, __capacity);
+		__words = NULL;
+		__size = 0;
+		__capacity = 0;
+	}
+
+	// zeroes the bits of the last word past size()
+	void	__clear_tail()
+	{
+		if (__size % detail::__bits_per_word != 0)
+			__words[__size / detail::__bits_per_word] &=
+				~(~word_type(0) << (__size % detail::__bits_per_word));
+	}
+
+	size_type	__find_from( size_type w ) const
+	{
+		size_type	words = detail::__words_for(__size);
+		for (; w < words; ++w)
+			if (__words[w] != 0)
+				return w * detail::__bits_per_word + __builtin_ctzll(__words[w]);
+		return npos;
+	}
+
+	void	__check_size( const vector& other ) const
+	{
+		if (other.__size != __size)
+			throw std::invalid_argument("vector: sizes differ");
+	}
+
+private:
+	__word_pointer		__words;
+	size_type			__size;
+	size_type			__capacity;
+	__word_allocator	__alloc;
+};
+
+template< class Allocator, class Growth >
+const typename vector<bool, Allocator, Growth>::size_type
+	vector<bool, Allocator, Growth>::npos;
+
+// both vector<bool> and growth::incremental are specializations and
+// neither is more specialized: the combination is left undefined
+template< class Allocator >
+class vector<bool, Allocator, growth::incremental>;
+
+template< class Allocator, class Growth >
+bool	operator==( const vector<bool, Allocator, Growth> & lhs,
+					const vector<bool, Allocator, Growth> & rhs )
+{
+	if (lhs.size() != rhs.size())
+		return false;
+	// empty vectors may have no storage, memcmp wants valid pointers
+	if (lhs.size_words() == 0)
+		return true;
+	// the bits past size() are 0 in both
+	return std::memcmp(lhs.data(), rhs.data(), lhs.size_words() * sizeof(uint64_t)) == 0;
+}
+
+template< class Allocator, class Growth >
+vector<bool, Allocator, Growth>	operator&( const vector<bool, Allocator, Growth> & lhs,
+											const vector<bool, Allocator, Growth> & rhs )
+{
+	vector<bool, Allocator, Growth>	res(lhs);
+	res &= rhs;
+	return res;
+}
+
+template< class Allocator, class Growth >
+vector<bool, Allocator, Growth>	operator|( const vector<bool, Allocator, Growth> & lhs,
+											const vector<bool, Allocator, Growth> & rhs )
+{
+	vector<bool, Allocator, Growth>	res(lhs);
+	res |= rhs;
+	return res;
+}
+
+template< class Allocator, class Growth >
+vector<bool, Allocator, Growth>	operator^( const vector<bool, Allocator, Growth> & lhs,
+											const vector<bool, Allocator, Growth> & rhs )
+{
+	vector<bool, Allocator, Growth>	res(lhs);
+	res ^= rhs;
+	return res;
+}
+
+} // namespace ft
+
+#endif // FT_VECTOR_BOOL_HPP